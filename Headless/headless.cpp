@@ -0,0 +1,282 @@
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "adjacency.h"
+#include "bitboard.h"
+#include "engine.h"
+#include "generator.h"
+#include "placement.h"
+
+
+/*
+        Desc: Plays A Single Game On The Given Engine By Revealing Random
+        Hidden Cells Until A Mine Is Hit Or Every Safe Cell Is Open.
+
+        Preconditions:
+            1.) engine Must Be Initialized With A Fresh Game
+            2.) rng Drives Which Cells Are Picked
+
+        Postconditions:
+            1.) Returns The Number Of Reveal Calls Made During The Game
+
+*/
+unsigned long long playRandomGame(Engine& engine, Xoshiro256& rng)
+{
+    const unsigned int rows = engine.getRowCount();
+    const unsigned int cols = engine.getColCount();
+    unsigned long long reveals = 0;
+
+    while (true)
+    {
+        if (engine.getGameState() != Engine::GameState::PLAYING)
+        {
+            return reveals;
+        }
+
+        // Nothing Is Flagged And No Mine Is Open While Playing, So Every Other Cell Is Hidden
+        unsigned int hiddenCount = rows * cols - engine.getRevealedSafeCount();
+
+        // Pick The n-th Hidden Cell
+        unsigned int target = static_cast<unsigned int>(rng.bounded(hiddenCount));
+
+        for (unsigned int i = 0; i < rows; ++i)
+        {
+            for (unsigned int j = 0; j < cols; ++j)
+            {
+                if (engine.getState(i, j) == Engine::CellState::HIDDEN && target-- == 0)
+                {
+                    ++reveals;
+                    engine.clearChanges();
+
+                    if (engine.reveal(i, j))
+                    {
+                        return reveals;
+                    }
+
+                    i = rows;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+
+/*
+        Desc: Checks Every Vector Path Of AdjacencyKernel Supported On This
+        Machine Against The Scalar Reference Over Random Mine Masks Of Awkward
+        Shapes (Widths Around Vector Sizes, Single Rows, Split Bands). The
+        Scalar Reference Is Itself Checked Against BitBoard's Bit-Sliced
+        Adder Network, Which Shares No Code With The Byte Kernels.
+
+        Preconditions:
+            1.) None
+
+        Postconditions:
+            1.) Each Mismatch Will Be Printed
+            2.) Returns true If Every Path Matched The Scalar Reference
+
+*/
+bool verifyAdjacencyKernels()
+{
+    const AdjacencyKernel::Isa paths[] = { AdjacencyKernel::Isa::SSE2, AdjacencyKernel::Isa::AVX2,
+        AdjacencyKernel::Isa::AVX512, AdjacencyKernel::Isa::NEON };
+    const unsigned int rowCounts[] = { 1, 2, 3, 17 };
+    const unsigned int colCounts[] = { 1, 2, 3, 15, 16, 17, 18, 31, 33, 34, 63, 65, 66, 129, 130, 200 };
+    const unsigned char mineBit = 0x40;
+
+    Xoshiro256 rng(0xAD1ACE);
+    bool passed = true;
+
+    for (unsigned int rows : rowCounts)
+    {
+        for (unsigned int cols : colCounts)
+        {
+            for (unsigned int density = 0; density <= 8; density += 2)
+            {
+                std::vector<unsigned char> mask(static_cast<size_t>(rows) * cols);
+
+                for (unsigned char& cell : mask)
+                {
+                    cell = rng.bounded(8) < density ? mineBit : 0;
+                }
+
+                std::vector<unsigned char> reference = mask;
+                AdjacencyKernel::countBand(reference.data(), rows, cols, nullptr, nullptr, mineBit, AdjacencyKernel::Isa::SCALAR);
+
+                BitBoard planes;
+                planes.resize(rows, cols);
+
+                for (size_t i = 0; i < mask.size(); ++i)
+                {
+                    if (mask[i])
+                    {
+                        planes.setMine(static_cast<unsigned int>(i / cols), static_cast<unsigned int>(i % cols));
+                    }
+                }
+
+                std::vector<unsigned char> sliced(mask.size());
+                planes.writeCells(sliced.data(), mineBit);
+
+                if (sliced != reference)
+                {
+                    std::cout << "Mismatch: Bit-Sliced BitBoard On " << rows << "x" << cols << " At Density " << density << "/8\n";
+                    passed = false;
+                }
+
+                for (AdjacencyKernel::Isa isa : paths)
+                {
+                    if (!AdjacencyKernel::isSupported(isa))
+                    {
+                        continue;
+                    }
+
+                    // Whole Board In One Band
+                    std::vector<unsigned char> whole = mask;
+                    AdjacencyKernel::countBand(whole.data(), rows, cols, nullptr, nullptr, mineBit, isa);
+
+                    // Two Bands Joined Through Halo Rows
+                    std::vector<unsigned char> split = mask;
+                    unsigned int top = rows / 2;
+
+                    if (top > 0)
+                    {
+                        std::vector<unsigned char> haloAbove(mask.begin() + (top - 1) * cols, mask.begin() + top * cols);
+                        std::vector<unsigned char> haloBelow(mask.begin() + top * cols, mask.begin() + (top + 1) * cols);
+
+                        AdjacencyKernel::countBand(split.data(), top, cols, nullptr, haloBelow.data(), mineBit, isa);
+                        AdjacencyKernel::countBand(split.data() + top * cols, rows - top, cols, haloAbove.data(), nullptr, mineBit, isa);
+                    }
+                    else
+                    {
+                        AdjacencyKernel::countBand(split.data(), rows, cols, nullptr, nullptr, mineBit, isa);
+                    }
+
+                    if (whole != reference || split != reference)
+                    {
+                        std::cout << "Mismatch: " << AdjacencyKernel::getName(isa) << " On " << rows << "x" << cols
+                                  << " At Density " << density << "/8\n";
+                        passed = false;
+                    }
+                }
+            }
+        }
+    }
+
+    std::cout << "Adjacency Kernels (Active: " << AdjacencyKernel::getName(AdjacencyKernel::active()) << ") "
+              << (passed ? "Match" : "Do Not Match") << " The Scalar And Bit-Sliced References\n";
+
+    return passed;
+}
+
+
+/*
+        Desc: Times TiledGenerator On A Single Board With A Given Thread Count
+        And Prints A Checksum Of The Result, So Scaling Can Be Measured And
+        Boards Generated With Different Thread Counts Can Be Compared.
+
+        Preconditions:
+            1.) mines Must Not Exceed rows * cols
+
+        Postconditions:
+            1.) Generation Time, Cells Per Second And An FNV-1a Checksum Will Be Printed
+
+*/
+void benchmarkGeneration(unsigned int rows, unsigned int cols, unsigned int mines, unsigned int threads, uint64_t seed)
+{
+    size_t cellCount = static_cast<size_t>(rows) * cols;
+    std::vector<unsigned char> cells(cellCount);
+    std::vector<unsigned int> mineIndices;
+
+    auto start = std::chrono::steady_clock::now();
+    TiledGenerator::generate(seed, cells.data(), rows, cols, mines, 0x40, mineIndices, threads);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    uint64_t checksum = 0xCBF29CE484222325ULL;
+
+    for (unsigned char cell : cells)
+    {
+        checksum = (checksum ^ cell) * 0x100000001B3ULL;
+    }
+
+    std::cout << "Generated A " << rows << "x" << cols << " Board With " << mines << " Mines On "
+              << (threads ? threads : std::thread::hardware_concurrency()) << " Thread(s) In " << elapsed.count() << "s ("
+              << cellCount / elapsed.count() / 1e6 << " MCells/s, Checksum " << std::hex << checksum << std::dec << ")\n";
+}
+
+
+/*
+        Desc: Entry Point For The Headless Runner Which Plays Games Against
+        The GL-Free Engine And Reports Throughput. No Window Or OpenGL
+        Context Is Created.
+
+        Usage:
+            Headless [games] [rows] [cols] [mines] [seed]
+            Headless --verify
+            Headless --generate [rows] [cols] [mines] [threads] [seed]
+
+        Game n Is Played On The Board Generated From seed + n, So The Same
+        Arguments Always Replay The Same Games.
+
+        Preconditions:
+            1.) Arguments, If Given, Must Be Positive Integers
+
+        Postconditions:
+            1.) The Requested Number Of Games Will Be Played
+            2.) Games Per Second And Average Reveals Per Game Will Be Printed
+            3.) --verify Checks The Vector Adjacency Kernels Instead, Returning 1 On Mismatch
+            4.) --generate Times A Single Board Generation Instead (threads 0 = All Cores)
+            5.) Application Will Return 0 On Successful Completion
+
+*/
+int main(int argc, char** argv)
+{
+    if (argc > 1 && std::strcmp(argv[1], "--verify") == 0)
+    {
+        return verifyAdjacencyKernels() ? 0 : 1;
+    }
+
+    if (argc > 1 && std::strcmp(argv[1], "--generate") == 0)
+    {
+        benchmarkGeneration(argc > 2 ? static_cast<unsigned int>(std::stoul(argv[2])) : 10000,
+                            argc > 3 ? static_cast<unsigned int>(std::stoul(argv[3])) : 10000,
+                            argc > 4 ? static_cast<unsigned int>(std::stoul(argv[4])) : 15000000,
+                            argc > 5 ? static_cast<unsigned int>(std::stoul(argv[5])) : 0,
+                            argc > 6 ? static_cast<uint64_t>(std::stoull(argv[6])) : 1);
+        return 0;
+    }
+
+    unsigned int games = argc > 1 ? static_cast<unsigned int>(std::stoul(argv[1])) : 1000;
+    unsigned int rows = argc > 2 ? static_cast<unsigned int>(std::stoul(argv[2])) : CONFIG::BOARD::ROW_COUNT;
+    unsigned int cols = argc > 3 ? static_cast<unsigned int>(std::stoul(argv[3])) : CONFIG::BOARD::COL_COUNT;
+    unsigned int mines = argc > 4 ? static_cast<unsigned int>(std::stoul(argv[4])) : CONFIG::BOARD::MINE_COUNT;
+    uint64_t seed = argc > 5 ? static_cast<uint64_t>(std::stoull(argv[5])) : 1;
+
+    Engine engine(rows, cols, mines);
+    engine.initialize(seed);
+
+    Xoshiro256 rng(seed);
+
+    unsigned long long totalReveals = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int game = 0; game < games; ++game)
+    {
+        if (game > 0)
+        {
+            engine.newGame(seed + game);
+        }
+        totalReveals += playRandomGame(engine, rng);
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Played " << games << " Games On A " << rows << "x" << cols << " Board In "
+              << elapsed.count() << "s (" << games / elapsed.count() << " Games/s, "
+              << static_cast<double>(totalReveals) / games << " Reveals/Game)\n";
+
+    return 0;
+}
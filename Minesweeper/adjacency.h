@@ -0,0 +1,424 @@
+#pragma once
+
+
+
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define ADJACENCY_X86
+	#include <immintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#endif
+#elif defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)
+	#define ADJACENCY_NEON
+	#include <arm_neon.h>
+#endif
+
+// GCC And Clang Need Per-Function Targets To Emit Wider ISAs From A Baseline Build, MSVC Does Not
+#if defined(ADJACENCY_X86) && (defined(__GNUC__) || defined(__clang__))
+	#define ADJACENCY_TARGET(isa) __attribute__((target(isa)))
+#else
+	#define ADJACENCY_TARGET(isa)
+#endif
+
+
+class AdjacencyKernel
+{
+
+	public:
+
+		// ~~~~~~ Instruction Sets ~~~~~~
+		enum class Isa { SCALAR, SSE2, AVX2, AVX512, NEON };
+
+
+	private:
+
+		/*
+
+			Desc: Scalar 3x3 Box Sum For A Single Cell With Full Bounds Checks.
+			Used For Border Columns, Tails And As The Reference Path.
+
+			Preconditions:
+				1.) up, mid And down Must Each Point At cols Bytes
+
+			Postconditions:
+				1.) mid[col] Will Have Its Neighbour Mine Count OR'd In
+
+		*/
+		static void cellScalar(const unsigned char* up, unsigned char* mid, const unsigned char* down, unsigned int col, unsigned int cols, unsigned char mineBit)
+		{
+
+			unsigned int first = col > 0 ? col - 1 : col;
+			unsigned int last = col + 1 < cols ? col + 1 : col;
+			unsigned char count = 0;
+
+			for (unsigned int c = first; c <= last; ++c)
+			{
+				count += (up[c] & mineBit) ? 1 : 0;
+				count += (down[c] & mineBit) ? 1 : 0;
+
+				if (c != col)
+				{
+					count += (mid[c] & mineBit) ? 1 : 0;
+				}
+			}
+
+			mid[col] |= count;
+
+		}
+
+
+		/*
+
+			Desc: Vector Row Kernels. Each Processes Interior Columns Starting At
+			begin In Whole Vector Steps While c + width Stays Below end, Loading
+			The Three Rows At Offsets -1, 0 And +1 And Summing The Eight
+			Neighbour Mine Bits Per Byte Lane.
+
+			Preconditions:
+				1.) begin Must Be At Least 1 And end At Most cols - 1
+
+			Postconditions:
+				1.) Returns The First Column Not Processed
+
+		*/
+		ADJACENCY_TARGET("sse2")
+		static unsigned int rowSSE2(const unsigned char* up, unsigned char* mid, const unsigned char* down, unsigned int begin, unsigned int end, unsigned char mineBit)
+		{
+
+			unsigned int c = begin;
+
+#if defined(ADJACENCY_X86)
+			const __m128i bit = _mm_set1_epi8(static_cast<char>(mineBit));
+			const __m128i one = _mm_set1_epi8(1);
+
+			for (; c + 16 <= end; c += 16)
+			{
+				#define ADJ_LOAD(row, off) _mm_min_epu8(_mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>((row) + c + (off))), bit), one)
+
+				__m128i sum = _mm_add_epi8(ADJ_LOAD(up, -1), ADJ_LOAD(up, 0));
+				sum = _mm_add_epi8(sum, ADJ_LOAD(up, 1));
+				sum = _mm_add_epi8(sum, ADJ_LOAD(mid, -1));
+				sum = _mm_add_epi8(sum, ADJ_LOAD(mid, 1));
+				sum = _mm_add_epi8(sum, ADJ_LOAD(down, -1));
+				sum = _mm_add_epi8(sum, ADJ_LOAD(down, 0));
+				sum = _mm_add_epi8(sum, ADJ_LOAD(down, 1));
+
+				#undef ADJ_LOAD
+
+				__m128i* dst = reinterpret_cast<__m128i*>(mid + c);
+				_mm_storeu_si128(dst, _mm_or_si128(_mm_loadu_si128(dst), sum));
+			}
+#else
+			(void)up; (void)mid; (void)down; (void)end; (void)mineBit;
+#endif
+
+			return c;
+
+		}
+
+		ADJACENCY_TARGET("avx2")
+		static unsigned int rowAVX2(const unsigned char* up, unsigned char* mid, const unsigned char* down, unsigned int begin, unsigned int end, unsigned char mineBit)
+		{
+
+			unsigned int c = begin;
+
+#if defined(ADJACENCY_X86)
+			const __m256i bit = _mm256_set1_epi8(static_cast<char>(mineBit));
+			const __m256i one = _mm256_set1_epi8(1);
+
+			for (; c + 32 <= end; c += 32)
+			{
+				#define ADJ_LOAD(row, off) _mm256_min_epu8(_mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>((row) + c + (off))), bit), one)
+
+				__m256i sum = _mm256_add_epi8(ADJ_LOAD(up, -1), ADJ_LOAD(up, 0));
+				sum = _mm256_add_epi8(sum, ADJ_LOAD(up, 1));
+				sum = _mm256_add_epi8(sum, ADJ_LOAD(mid, -1));
+				sum = _mm256_add_epi8(sum, ADJ_LOAD(mid, 1));
+				sum = _mm256_add_epi8(sum, ADJ_LOAD(down, -1));
+				sum = _mm256_add_epi8(sum, ADJ_LOAD(down, 0));
+				sum = _mm256_add_epi8(sum, ADJ_LOAD(down, 1));
+
+				#undef ADJ_LOAD
+
+				__m256i* dst = reinterpret_cast<__m256i*>(mid + c);
+				_mm256_storeu_si256(dst, _mm256_or_si256(_mm256_loadu_si256(dst), sum));
+			}
+#else
+			(void)up; (void)mid; (void)down; (void)end; (void)mineBit;
+#endif
+
+			return c;
+
+		}
+
+		ADJACENCY_TARGET("avx512f,avx512bw")
+		static unsigned int rowAVX512(const unsigned char* up, unsigned char* mid, const unsigned char* down, unsigned int begin, unsigned int end, unsigned char mineBit)
+		{
+
+			unsigned int c = begin;
+
+#if defined(ADJACENCY_X86)
+			const __m512i bit = _mm512_set1_epi8(static_cast<char>(mineBit));
+			const __m512i one = _mm512_set1_epi8(1);
+
+			for (; c + 64 <= end; c += 64)
+			{
+				#define ADJ_LOAD(row, off) _mm512_min_epu8(_mm512_and_si512(_mm512_loadu_si512((row) + c + (off)), bit), one)
+
+				__m512i sum = _mm512_add_epi8(ADJ_LOAD(up, -1), ADJ_LOAD(up, 0));
+				sum = _mm512_add_epi8(sum, ADJ_LOAD(up, 1));
+				sum = _mm512_add_epi8(sum, ADJ_LOAD(mid, -1));
+				sum = _mm512_add_epi8(sum, ADJ_LOAD(mid, 1));
+				sum = _mm512_add_epi8(sum, ADJ_LOAD(down, -1));
+				sum = _mm512_add_epi8(sum, ADJ_LOAD(down, 0));
+				sum = _mm512_add_epi8(sum, ADJ_LOAD(down, 1));
+
+				#undef ADJ_LOAD
+
+				_mm512_storeu_si512(mid + c, _mm512_or_si512(_mm512_loadu_si512(mid + c), sum));
+			}
+#else
+			(void)up; (void)mid; (void)down; (void)end; (void)mineBit;
+#endif
+
+			return c;
+
+		}
+
+		static unsigned int rowNEON(const unsigned char* up, unsigned char* mid, const unsigned char* down, unsigned int begin, unsigned int end, unsigned char mineBit)
+		{
+
+			unsigned int c = begin;
+
+#if defined(ADJACENCY_NEON)
+			const uint8x16_t bit = vdupq_n_u8(mineBit);
+			const uint8x16_t one = vdupq_n_u8(1);
+
+			for (; c + 16 <= end; c += 16)
+			{
+				#define ADJ_LOAD(row, off) vminq_u8(vandq_u8(vld1q_u8((row) + c + (off)), bit), one)
+
+				uint8x16_t sum = vaddq_u8(ADJ_LOAD(up, -1), ADJ_LOAD(up, 0));
+				sum = vaddq_u8(sum, ADJ_LOAD(up, 1));
+				sum = vaddq_u8(sum, ADJ_LOAD(mid, -1));
+				sum = vaddq_u8(sum, ADJ_LOAD(mid, 1));
+				sum = vaddq_u8(sum, ADJ_LOAD(down, -1));
+				sum = vaddq_u8(sum, ADJ_LOAD(down, 0));
+				sum = vaddq_u8(sum, ADJ_LOAD(down, 1));
+
+				#undef ADJ_LOAD
+
+				vst1q_u8(mid + c, vorrq_u8(vld1q_u8(mid + c), sum));
+			}
+#else
+			(void)up; (void)mid; (void)down; (void)end; (void)mineBit;
+#endif
+
+			return c;
+
+		}
+
+
+		/*
+
+			Desc: Queries The CPU For The Widest Supported Instruction Set,
+			Including OS Support For The Wider Register State.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Best Isa This Machine Can Run
+
+		*/
+		static Isa detect()
+		{
+
+#if defined(ADJACENCY_X86) && defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 0);
+			int maxLeaf = info[0];
+
+			__cpuid(info, 1);
+			bool osxsave = (info[2] & (1 << 27)) != 0;
+			bool hasSSE2 = (info[3] & (1 << 26)) != 0;
+
+			if (osxsave && maxLeaf >= 7)
+			{
+				unsigned long long xcr0 = _xgetbv(0);
+				__cpuidex(info, 7, 0);
+
+				bool hasAVX512 = (info[1] & (1 << 16)) && (info[1] & (1 << 30)) && (xcr0 & 0xE6) == 0xE6;
+				bool hasAVX2 = (info[1] & (1 << 5)) && (xcr0 & 0x6) == 0x6;
+
+				if (hasAVX512) return Isa::AVX512;
+				if (hasAVX2) return Isa::AVX2;
+			}
+
+			return hasSSE2 ? Isa::SSE2 : Isa::SCALAR;
+#elif defined(ADJACENCY_X86)
+			__builtin_cpu_init();
+
+			if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return Isa::AVX512;
+			if (__builtin_cpu_supports("avx2")) return Isa::AVX2;
+			if (__builtin_cpu_supports("sse2")) return Isa::SSE2;
+
+			return Isa::SCALAR;
+#elif defined(ADJACENCY_NEON)
+			return Isa::NEON;
+#else
+			return Isa::SCALAR;
+#endif
+
+		}
+
+
+
+	public:
+
+		/*
+
+			Desc: Returns The Instruction Set Picked For This Machine. Detection
+			Runs Once And Is Cached.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Active Isa
+
+		*/
+		static Isa active()
+		{
+
+			static const Isa isa = detect();
+			return isa;
+
+		}
+
+
+		/*
+
+			Desc: Reports Whether An Isa Can Run On This Machine.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns true If isa Is SCALAR Or No Wider Than active()
+
+		*/
+		static bool isSupported(Isa isa)
+		{
+
+			Isa best = active();
+
+			switch (isa)
+			{
+				case Isa::SCALAR: return true;
+				case Isa::SSE2: return best == Isa::SSE2 || best == Isa::AVX2 || best == Isa::AVX512;
+				case Isa::AVX2: return best == Isa::AVX2 || best == Isa::AVX512;
+				case Isa::AVX512: return best == Isa::AVX512;
+				case Isa::NEON: return best == Isa::NEON;
+			}
+
+			return false;
+
+		}
+
+
+		/*
+
+			Desc: Returns A Printable Name For An Isa.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns A Static String
+
+		*/
+		static const char* getName(Isa isa)
+		{
+
+			switch (isa)
+			{
+				case Isa::SCALAR: return "Scalar";
+				case Isa::SSE2: return "SSE2";
+				case Isa::AVX2: return "AVX2";
+				case Isa::AVX512: return "AVX-512";
+				case Isa::NEON: return "NEON";
+			}
+
+			return "Unknown";
+
+		}
+
+
+		/*
+
+			Desc: Adds The Adjacent Mine Count Into Every Cell Of A Band Of Rows.
+			Cells Are Read For Their mineBit Only And The Count Is OR'd Into The
+			Low Bits, So The Band Is Updated In Place. Rows Just Outside The Band
+			Come From above And below (Copies Of The Neighbouring Rows, Or Null
+			At The Board Edge) So Bands Can Be Processed Independently.
+
+			Preconditions:
+				1.) cells Must Hold rows * cols Bytes With Zeroed Count Bits
+				2.) above And below Must Be Null Or Point At cols Bytes
+				3.) isa Must Be Supported On This Machine
+
+			Postconditions:
+				1.) Each Cell's Low Bits Will Hold Its Neighbour Mine Count (0-8)
+				2.) mineBit And All Other High Bits Will Be Unchanged
+
+		*/
+		static void countBand(unsigned char* cells, unsigned int rows, unsigned int cols,
+			const unsigned char* above, const unsigned char* below, unsigned char mineBit, Isa isa = active())
+		{
+
+			if (rows == 0 || cols == 0)
+			{
+				return;
+			}
+
+			std::vector<unsigned char> zeros;
+
+			if (!above || !below)
+			{
+				zeros.assign(cols, 0);
+			}
+
+			for (unsigned int r = 0; r < rows; ++r)
+			{
+				unsigned char* mid = cells + static_cast<size_t>(r) * cols;
+				const unsigned char* up = r > 0 ? mid - cols : (above ? above : zeros.data());
+				const unsigned char* down = r + 1 < rows ? mid + cols : (below ? below : zeros.data());
+
+				unsigned int c = 0;
+
+				if (cols > 2)
+				{
+					cellScalar(up, mid, down, 0, cols, mineBit);
+
+					switch (isa)
+					{
+						case Isa::SSE2: c = rowSSE2(up, mid, down, 1, cols - 1, mineBit); break;
+						case Isa::AVX2: c = rowAVX2(up, mid, down, 1, cols - 1, mineBit); break;
+						case Isa::AVX512: c = rowAVX512(up, mid, down, 1, cols - 1, mineBit); break;
+						case Isa::NEON: c = rowNEON(up, mid, down, 1, cols - 1, mineBit); break;
+						default: c = 1; break;
+					}
+				}
+
+				for (; c < cols; ++c)
+				{
+					cellScalar(up, mid, down, c, cols, mineBit);
+				}
+			}
+
+		}
+
+};
\ No newline at end of file
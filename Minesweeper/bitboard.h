@@ -0,0 +1,244 @@
+#pragma once
+
+
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+
+// Mine Bitplane With Bit-Sliced Adjacent Counting. The Engine Counts With
+// AdjacencyKernel And Keeps Revealed And Flagged Totals As O(1) Counters, So
+// This Backend Only Holds Mines; Headless --verify Uses It As A Reference
+// Built Independently Of The Byte Kernels.
+class BitBoard
+{
+
+	private:
+
+		// ~~~~~~ Board Dimensions ~~~~~~
+		unsigned int row_count = 0, col_count = 0;
+		unsigned int wordsPerRow = 0;
+
+
+		// ~~~~~~ Mine Bitplane (Bit j Of Word w = Column w * 64 + j) ~~~~~~
+		std::vector<uint64_t> mines;
+
+
+		/*
+
+			Desc: Reads A Word From A Plane, Treating Rows Outside The Board As
+			Empty So Edge Rows Need No Special Casing.
+
+			Preconditions:
+				1.) word Must Be Less Than wordsPerRow
+
+			Postconditions:
+				1.) Returns The Word Or 0 If row Is Off The Board
+
+		*/
+		uint64_t wordAt(const std::vector<uint64_t>& plane, long long row, unsigned int word) const
+		{
+
+			if (row < 0 || row >= static_cast<long long>(this->row_count))
+			{
+				return 0;
+			}
+
+			return plane[static_cast<size_t>(row) * this->wordsPerRow + word];
+
+		}
+
+
+		/*
+
+			Desc: Bit-Sliced Full And Half Adders. Each Call Adds 64 Independent
+			Lanes At Once, Returning The Sum Bit And Writing The Carry Bit.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) carry Will Hold The Carry Lanes, Sum Lanes Are Returned
+
+		*/
+		static uint64_t fullAdd(uint64_t a, uint64_t b, uint64_t c, uint64_t& carry)
+		{
+
+			uint64_t ab = a ^ b;
+			carry = (a & b) | (c & ab);
+			return ab ^ c;
+
+		}
+
+		static uint64_t halfAdd(uint64_t a, uint64_t b, uint64_t& carry)
+		{
+
+			carry = a & b;
+			return a ^ b;
+
+		}
+
+
+
+	public:
+
+		/*
+
+			Desc: Sizes The Mine Plane For The Given Board And Clears It.
+
+			Preconditions:
+				1.) row_count And col_count Must Be Valid Board Dimensions
+
+			Postconditions:
+				1.) mines Will Be Allocated And Zeroed
+
+		*/
+		void resize(unsigned int row_count, unsigned int col_count)
+		{
+
+			this->row_count = row_count;
+			this->col_count = col_count;
+			this->wordsPerRow = (col_count + 63) / 64;
+			this->mines.assign(static_cast<size_t>(row_count) * this->wordsPerRow, 0);
+
+		}
+
+
+		/*
+
+			Desc: Per-Cell Mine Bit Accessors.
+
+			Preconditions:
+				1.) row And col Must Be Valid Cell Coordinates
+
+			Postconditions:
+				1.) setMine Writes The Bit, isMine Reads It
+
+		*/
+		void setMine(unsigned int row, unsigned int col)
+		{
+
+			this->mines[static_cast<size_t>(row) * this->wordsPerRow + col / 64] |= 1ULL << (col % 64);
+
+		}
+
+		bool isMine(unsigned int row, unsigned int col) const
+		{
+
+			return (this->mines[static_cast<size_t>(row) * this->wordsPerRow + col / 64] >> (col % 64)) & 1;
+
+		}
+
+
+		/*
+
+			Desc: Computes The Adjacent Mine Count Of Every Cell With A
+			Bit-Sliced Adder Network. For Each 64-Cell Word The Eight Neighbour
+			Planes (Rows Above And Below Plus Their Horizontal Shifts, And The
+			Row's Own Horizontal Shifts) Are Summed Into A 4-Bit Count Spread
+			Across Four Words, Then Expanded Into One Byte Per Cell.
+
+			Preconditions:
+				1.) out Must Hold row_count * col_count Bytes
+				2.) Mine Bits Past col_count In Each Row Must Be Zero
+
+			Postconditions:
+				1.) out[row * col_count + col] Will Hold The Count (0-8),
+				    OR'd With mineBit If The Cell Is A Mine
+
+		*/
+		void writeCells(unsigned char* out, unsigned char mineBit) const
+		{
+
+			for (unsigned int r = 0; r < this->row_count; ++r)
+			{
+				for (unsigned int w = 0; w < this->wordsPerRow; ++w)
+				{
+					uint64_t lane[8];
+					unsigned int inputs = 0;
+
+					for (long long dr = -1; dr <= 1; ++dr)
+					{
+						long long nr = static_cast<long long>(r) + dr;
+
+						uint64_t mid = this->wordAt(this->mines, nr, w);
+						uint64_t prev = w > 0 ? this->wordAt(this->mines, nr, w - 1) : 0;
+						uint64_t next = w + 1 < this->wordsPerRow ? this->wordAt(this->mines, nr, w + 1) : 0;
+
+						lane[inputs++] = (mid << 1) | (prev >> 63);		// West Neighbour
+						lane[inputs++] = (mid >> 1) | (next << 63);		// East Neighbour
+
+						if (dr != 0)
+						{
+							lane[inputs++] = mid;						// North / South Neighbour
+						}
+					}
+
+					// Carry-Save Reduction Of Eight 1-Bit Lanes Into A 4-Bit Sum
+					uint64_t c0, c1, c2, c3, c4, c5;
+					uint64_t s0 = fullAdd(lane[0], lane[1], lane[2], c0);
+					uint64_t s1 = fullAdd(lane[3], lane[4], lane[5], c1);
+					uint64_t s2 = halfAdd(lane[6], lane[7], c2);
+
+					uint64_t bit0 = fullAdd(s0, s1, s2, c3);
+					uint64_t t = fullAdd(c0, c1, c2, c4);
+					uint64_t bit1 = halfAdd(t, c3, c5);
+					uint64_t bit2 = c4 ^ c5;
+					uint64_t bit3 = c4 & c5;
+
+					uint64_t self = this->mines[static_cast<size_t>(r) * this->wordsPerRow + w];
+
+					// Expand The Four Count Planes Into Bytes
+					unsigned int base = w * 64;
+					unsigned int width = (w + 1 == this->wordsPerRow) ? this->col_count - base : 64;
+					unsigned char* dst = out + static_cast<size_t>(r) * this->col_count + base;
+
+					if ((bit0 | bit1 | bit2 | bit3 | self) == 0)
+					{
+						std::fill(dst, dst + width, static_cast<unsigned char>(0));
+						continue;
+					}
+
+					for (unsigned int j = 0; j < width; ++j)
+					{
+						dst[j] = static_cast<unsigned char>(
+							((bit0 >> j) & 1) |
+							(((bit1 >> j) & 1) << 1) |
+							(((bit2 >> j) & 1) << 2) |
+							(((bit3 >> j) & 1) << 3) |
+							(((self >> j) & 1) ? mineBit : 0));
+					}
+				}
+			}
+
+		}
+
+
+		/*
+
+			Desc: Counts The Mines On The Board With A Popcount Per Word.
+
+			Preconditions:
+				1.) resize() Must Have Been Called
+
+			Postconditions:
+				1.) Returns The Number Of Mine Bits Set
+
+		*/
+		unsigned long long getMineTotal() const
+		{
+
+			unsigned long long total = 0;
+
+			for (uint64_t word : this->mines)
+			{
+				total += std::bitset<64>(word).count();
+			}
+
+			return total;
+
+		}
+
+};
\ No newline at end of file
@@ -4,9 +4,20 @@
 
 #include "config.h"
 #include <glad/glad.h>
-#include <random>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "camera.h"
+#include "engine.h"
+#include "frameprofiler.h"
+#include "glstate.h"
+#include "glyphatlas.h"
+#include "latencytracker.h"
+#include "lodpyramid.h"
+#include "shader.h"
 #include "vertex.h"
-#include <stack>
 
 
 class Board
@@ -23,46 +34,70 @@ class Board
 		float xOffset, yOffset;
 
 
-		// ~~~~~~ Board State ~~~~~~
-		enum class CellState { HIDDEN, REVEALED, FLAGGED };
-
-		struct Cell
-		{
-
-			CellState state = CellState::HIDDEN;
-			unsigned int adjacentMines = 0, vboOffset;
-			bool isMine = false;
-
-		};
+		// ~~~~~~ Game State ~~~~~~
+		Engine engine;
 
 
 		// ~~~~~~ Board Data ~~~~~~
-		Cell** cells;
 		unsigned int row_count, col_count;
-		unsigned int mineCount;
 
 
 		// ~~~~~~ Board Rendering ~~~~~~
-		GLuint VBO, EBO;
+		GLuint VBO = 0, EBO = 0;								// Vertex Mode: One CellVertex Per Cell, Optional Shared Index Pattern
+		GLuint cellTexture = 0;									// Vertex Mode: Buffer Texture Over VBO On Texture Unit 3
+		GLuint packedVAO = 0;									// Every Cell Mode And The Overview Quad (No Vertex Attributes Besides Instanced Bytes)
 
 
-		// ~~~~~ Vertex Data ~~~~~~
-		Vertex* vertices;
-		unsigned int* indices;
+		// ~~~~~~ Packed Cell Rendering (One Engine Byte Per Cell On The GPU) ~~~~~~
+		using CellRenderer = CONFIG::BOARD::CellRenderer;
+		CellRenderer renderer = CONFIG::BOARD::CELL_RENDERER;
+		GLuint stateVBO = 0;									// Instanced Mode
+		GLuint stateTexture = 0;								// State Texture Mode
+		unsigned int stateWidth = 0, stateHeight = 0;
+
+
+		// ~~~~~~ Level Of Detail (Aggregated Cell State For Zoomed Out Views) ~~~~~~
+		LodPyramid lod;
+		GLuint lodTexture = 0;									// Texture Unit 2, One Mip Level Per Pyramid Level
+		bool useLod = false;
 
 
-		// ~~~~~~ Flood Fill (Avoid Recursion) ~~~~~~
-		bool visited[CONFIG::BOARD::ROW_COUNT][CONFIG::BOARD::COL_COUNT] = { false };
+		// ~~~~~~ View Culling (Vertex Mode Numbers Only The Visible Cell Rectangle) ~~~~~~
+		static constexpr unsigned int INDEX_BATCH_CELLS = 65536 / 4;	// Cells Whose Four Vertices Fit 16-Bit Indices
+		std::vector<GLsizei> drawCounts;						// Shared Index Batches Covering The Visible Cells
+		std::vector<const void*> drawOffsets;
+		std::vector<GLint> drawBaseVertices;
+		size_t firstInstance = 0;								// Instanced Mode: First Cell Of The Visible Row Band
+		size_t visibleCells = 0;
+
+
+		// ~~~~~~ Shader Constants (Uploaded Once, View Uniforms Again When The Camera Or Viewport Change) ~~~~~~
+		bool uniformsSet = false;
+		bool viewDirty = true;
+		unsigned long long cameraRevision = 0;
+		unsigned int viewportWidth = CONFIG::WINDOW::WIDTH, viewportHeight = CONFIG::WINDOW::HEIGHT;
+
+
+		// ~~~~~ Vertex Data ~~~~~~
+		CellVertex* vertices = nullptr;
 
 
 		// ~~~~~ Text Rendering ~~~~~~
 		GLuint proceduralAtlasTextureID;
 
 
+		// ~~~~~ Dirty Upload Tracking ~~~~~~
+		std::vector<uint64_t> dirtyBits;
+		std::vector<unsigned int> dirtyCells;
+		unsigned long long lastUploadBytes = 0;
+		unsigned long long totalUploadBytes = 0;
+
+
 		/*
 		
-			Desc: Generates A Procedural Texture Atlas Containing Digit Patterns
-			For Numbers 0-9 And A Flag Symbol For Use In Rendering Game Elements.
+			Desc: Uploads The Glyph Atlas Holding Digits 0-9 And The Flag Symbol.
+			The Texels Are Generated At Compile Time By GlyphAtlas, So This Is
+			Just The Texture Creation And Upload.
 
 			Preconditions:
 				1.) OpenGL Context Must Be Active And Valid
@@ -71,638 +106,651 @@ class Board
 			Postconditions:
 				1.) proceduralAtlasTextureID Will Contain A Valid OpenGL Texture ID
 				2.) Texture Will Be Uploaded To GPU Memory With Digit And Flag Patterns
-				3.) Texture Parameters Will Be Set For Nearest Neighbor Filtering
+				3.) Texture Filtering Will Be Nearest Neighbor, Or Linear For A
+				    Distance Field Atlas
 
 		*/
 		void generateDigits()
 		{
 
+			const GLint filter = CONFIG::SHADER::TEXT_ATLAS::DISTANCE_FIELD ? GL_LINEAR : GL_NEAREST;
+
 			// Generate Texture
 			glGenTextures(1, &this->proceduralAtlasTextureID);
-			glBindTexture(GL_TEXTURE_2D, this->proceduralAtlasTextureID);
+			GLState::get().selectTexture(0, this->proceduralAtlasTextureID);
 
 			// Texture Parameters
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-
-			// Initialize Texture Data (Grayscale: 0 = Black, 255 = White)
-			unsigned char data[CONFIG::SHADER::TEXT_ATLAS::ATLAS_WIDTH * CONFIG::SHADER::TEXT_ATLAS::ATLAS_HEIGHT];
-			memset(data, 0, sizeof(data)); // Initialize To Black
-
-			// 8x16 Bit Patterns For Digits 0-9 (Each Row Is A Byte)
-			const unsigned char digitPatterns[10][16] = {
-				// 0
-				{0b01111110, 0b11000011, 0b11000011, 0b11000011,
-				 0b11000011, 0b11001011, 0b11010011, 0b11100011,
-				 0b11000011, 0b11000011, 0b11000011, 0b11000011,
-				 0b11000011, 0b11000011, 0b11000011, 0b01111110},
-
-				 // 1
-				 {0b00011000, 0b00111000, 0b01111000, 0b00011000,
-				  0b00011000, 0b00011000, 0b00011000, 0b00011000,
-				  0b00011000, 0b00011000, 0b00011000, 0b00011000,
-				  0b00011000, 0b00011000, 0b00011000, 0b11111111},
-
-				  // 2
-				  {0b01111110, 0b11000011, 0b11000011, 0b00000011,
-				   0b00000011, 0b00000110, 0b00001100, 0b00011000,
-				   0b00110000, 0b01100000, 0b11000000, 0b11000000,
-				   0b11000000, 0b11000000, 0b11111111, 0b11111111},
-
-				   // 3
-				   {0b01111110, 0b11000011, 0b11000011, 0b00000011,
-					0b00000011, 0b00000110, 0b00111100, 0b00000110,
-					0b00000011, 0b00000011, 0b11000011, 0b11000011,
-					0b11000011, 0b11000011, 0b11000011, 0b01111110},
-
-					// 4
-					{0b11000011, 0b11000011, 0b11000011, 0b11000011,
-					 0b11000011, 0b11000011, 0b11111111, 0b11111111,
-					 0b00000011, 0b00000011, 0b00000011, 0b00000011,
-					 0b00000011, 0b00000011, 0b00000011, 0b00000011},
-
-					 // 5
-					 {0b11111111, 0b11111111, 0b11000000, 0b11000000,
-					  0b11000000, 0b11000000, 0b11111110, 0b01111111,
-					  0b00000011, 0b00000011, 0b00000011, 0b11000011,
-					  0b11000011, 0b11000011, 0b11000011, 0b01111110},
-
-					  // 6
-					  {0b01111110, 0b11000011, 0b11000011, 0b11000000,
-					   0b11000000, 0b11000000, 0b11111110, 0b11111111,
-					   0b11000011, 0b11000011, 0b11000011, 0b11000011,
-					   0b11000011, 0b11000011, 0b11000011, 0b01111110},
-
-					   // 7
-					   {0b11111111, 0b11111111, 0b00000011, 0b00000011,
-						0b00000110, 0b00000110, 0b00001100, 0b00001100,
-						0b00011000, 0b00011000, 0b00110000, 0b00110000,
-						0b01100000, 0b01100000, 0b11000000, 0b11000000},
-
-						// 8
-						{0b01111110, 0b11000011, 0b11000011, 0b11000011,
-						 0b11000011, 0b01111110, 0b01111110, 0b01111110,
-						 0b11000011, 0b11000011, 0b11000011, 0b11000011,
-						 0b11000011, 0b11000011, 0b11000011, 0b01111110},
-
-						 // 9
-						 {0b01111110, 0b11000011, 0b11000011, 0b11000011,
-						  0b11000011, 0b11000011, 0b11000011, 0b11111111,
-						  0b01111111, 0b00000011, 0b00000011, 0b00000011,
-						  0b11000011, 0b11000011, 0b11000011, 0b01111110}
-			};
-
-			const unsigned char flagPattern[16] = {
-				0b00000100, // Flagpole
-				0b11111100, // Full flag with pole
-				0b11111100, // Full flag
-				0b11111100, // Full flag
-				0b11111100, // Full flag
-				0b11111100, // Full flag
-				0b11111100, // Full flag
-				0b00001000, // Just pole
-				0b00001000, // Pole
-				0b00001000, // Pole
-				0b00001000, // Pole
-				0b00001000, // Pole
-				0b00001000, // Pole
-				0b00001000, // Pole
-				0b00001000, // Pole
-				0b11111111  // Base
-			};
-
-			// Generate Each Digit In The Atlas With Padding
-			for (unsigned int digit = 0; digit < 10; ++digit) {
-				unsigned int charSlotWidth = CONFIG::SHADER::TEXT_ATLAS::CHAR_WIDTH;
-				unsigned int charSlotHeight = CONFIG::SHADER::TEXT_ATLAS::ATLAS_HEIGHT;
-
-				// Calculate Padding (20% On Each Side)
-				float paddingRatio = 0.2f;
-				unsigned int horizontalPadding = (unsigned int)(charSlotWidth * paddingRatio);
-				unsigned int verticalPadding = (unsigned int)(charSlotHeight * paddingRatio);
-
-				// Calculate Actual Character Area
-				unsigned int actualCharWidth = charSlotWidth - 2 * horizontalPadding;
-				unsigned int actualCharHeight = charSlotHeight - 2 * verticalPadding;
-
-				// Starting Position For This Digit (With Padding)
-				unsigned int startX = digit * charSlotWidth + horizontalPadding;
-				unsigned int startY = verticalPadding;
-
-				// Process Each Row Of The Digit Pattern
-				for (unsigned int row = 0; row < 16; ++row) {
-					unsigned char pattern = digitPatterns[digit][row];
-
-					// Scale Row To Fit In Actual Character Area
-					unsigned int scaledY = startY + (row * actualCharHeight) / 16;
-
-					// Process Each Bit In The Row
-					for (unsigned int col = 0; col < 8; ++col) {
-						if (pattern & (0b10000000 >> col)) {
-							// Scale Column To Fit In Actual Character Area
-							unsigned int scaledX = startX + (col * actualCharWidth) / 8;
-
-							// Draw 2x2 Pixel Block For Better Visibility
-							for (unsigned int scaleY = 0; scaleY < 2 && scaledY + scaleY < CONFIG::SHADER::TEXT_ATLAS::ATLAS_HEIGHT; ++scaleY) {
-								for (unsigned int scaleX = 0; scaleX < 2 && scaledX + scaleX < CONFIG::SHADER::TEXT_ATLAS::ATLAS_WIDTH; ++scaleX) {
-									unsigned int x = scaledX + scaleX;
-									unsigned int y = scaledY + scaleY;
-
-									if (x < CONFIG::SHADER::TEXT_ATLAS::ATLAS_WIDTH && y < CONFIG::SHADER::TEXT_ATLAS::ATLAS_HEIGHT) {
-										data[y * CONFIG::SHADER::TEXT_ATLAS::ATLAS_WIDTH + x] = 255; // White Pixel
-									}
-								}
-							}
-						}
-					}
-				}
-			}
-
-			{
-				unsigned int charSlotWidth = CONFIG::SHADER::TEXT_ATLAS::CHAR_WIDTH;
-				unsigned int charSlotHeight = CONFIG::SHADER::TEXT_ATLAS::ATLAS_HEIGHT;
-
-				// Calculate Padding (20% On Each Side)
-				float paddingRatio = 0.2f;
-				unsigned int horizontalPadding = (unsigned int)(charSlotWidth * paddingRatio);
-				unsigned int verticalPadding = (unsigned int)(charSlotHeight * paddingRatio);
-
-				// Calculate Actual Character Area
-				unsigned int actualCharWidth = charSlotWidth - 2 * horizontalPadding;
-				unsigned int actualCharHeight = charSlotHeight - 2 * verticalPadding;
-
-				// Starting Position For This Digit (With Padding)
-				unsigned int startX = CONFIG::SHADER::TEXT_ATLAS::NUM_DIGITS * charSlotWidth + horizontalPadding;
-				unsigned int startY = verticalPadding;
-
-				// Process Each Row Of The Flag Pattern
-				for (unsigned int row = 0; row < 16; ++row) {
-					unsigned char pattern = flagPattern[row];
-					unsigned int scaledY = startY + (row * actualCharHeight) / 16;
-
-					// Process Each Bit In The Row
-					for (unsigned int col = 0; col < 8; ++col) {
-						if (pattern & (0b10000000 >> col)) {
-							// Scale Column To Fit In Actual Character Area
-							unsigned int scaledX = startX + (col * actualCharWidth) / 8;
-
-							// Draw 2x2 Pixel Block For Better Visibility
-							for (unsigned int scaleY = 0; scaleY < 2 && scaledY + scaleY < CONFIG::SHADER::TEXT_ATLAS::ATLAS_HEIGHT; ++scaleY) {
-								for (unsigned int scaleX = 0; scaleX < 2 && scaledX + scaleX < CONFIG::SHADER::TEXT_ATLAS::ATLAS_WIDTH; ++scaleX) {
-									unsigned int x = scaledX + scaleX;
-									unsigned int y = scaledY + scaleY;
-
-									if (x < CONFIG::SHADER::TEXT_ATLAS::ATLAS_WIDTH && y < CONFIG::SHADER::TEXT_ATLAS::ATLAS_HEIGHT) {
-										data[y * CONFIG::SHADER::TEXT_ATLAS::ATLAS_WIDTH + x] = 255; // White Pixel
-									}
-								}
-							}
-						}
-					}
-				}
-			}
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
 
 			// Upload Texture Data To GPU
-			glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, CONFIG::SHADER::TEXT_ATLAS::ATLAS_WIDTH, CONFIG::SHADER::TEXT_ATLAS::ATLAS_HEIGHT, 0, GL_RED, GL_UNSIGNED_BYTE, data);
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, GlyphAtlas::WIDTH, GlyphAtlas::HEIGHT, 0, GL_RED, GL_UNSIGNED_BYTE, GlyphAtlas::getTexels());
 	
 		}
 
 
 		/*
-		
-			Desc: Sets The UV Coordinates For A Cell To Display The Flag Symbol
-			From The Procedural Texture Atlas.
+
+			Desc: Sets The Atlas Glyph Drawn Over A Cell. The Vertex Shader Turns
+			The Slot And Each Vertex's Quad Corner Into UVs.
 
 			Preconditions:
 				1.) row And col Must Be Valid Cell Coordinates Within The Board
 				2.) vertices Array Must Be Properly Initialized
-				3.) Texture Atlas Must Have Been Generated With Flag Symbol
+				3.) glyph Must Be An Atlas Slot (Digits 0-9, FLAG_INDEX) Or Vertex::NO_GLYPH
 
 			Postconditions:
-				1.) The Four Vertices Of The Specified Cell Will Have UV Coordinates
-				2.) UV Coordinates Will Map To The Flag Symbol In The Texture Atlas
+				1.) The Specified Cell Will Carry glyph
 
 		*/
-		void setFlagUVs(unsigned int row, unsigned int col)
+		void setGlyph(unsigned int row, unsigned int col, unsigned char glyph)
 		{
 
-			// Calculate UV Coordinates For The Flag
-			float symbolWidth = 1.0f / CONFIG::SHADER::TEXT_ATLAS::TOTAL_CHARS;
-
-			float paddingRatio = 0.0f; // Match Your Digit Padding
-			float actualSymbolWidth = symbolWidth * (1.0f - 2.0f * paddingRatio);
-			float paddingWidth = symbolWidth * paddingRatio;
-
-			float u1 = CONFIG::SHADER::TEXT_ATLAS::FLAG_INDEX * symbolWidth + paddingWidth;
-			float v1 = paddingRatio;
-			float u2 = u1 + actualSymbolWidth;
-			float v2 = 1.0f - paddingRatio;
-
-			unsigned int vertexIndex = (row * this->col_count + col) * 4;
+			this->vertices[row * this->col_count + col].glyph = glyph;
 
-			// Apply flag UV coordinates
-			this->vertices[vertexIndex + 0].uvs[0] = u2; this->vertices[vertexIndex + 0].uvs[1] = v1; // Bottom Right
-			this->vertices[vertexIndex + 1].uvs[0] = u2; this->vertices[vertexIndex + 1].uvs[1] = v2; // Top Right  
-			this->vertices[vertexIndex + 2].uvs[0] = u1; this->vertices[vertexIndex + 2].uvs[1] = v2; // Top Left
-			this->vertices[vertexIndex + 3].uvs[0] = u1; this->vertices[vertexIndex + 3].uvs[1] = v1; // Bottom Left
 		}
 
 
 		/*
 
-			Desc: Sets The UV Coordinates For A Cell To Display A Specific Number
-			From The Procedural Texture Atlas.
+			Desc: Sets The Colour Of A Cell From [0, 1] Channels.
 
 			Preconditions:
 				1.) row And col Must Be Valid Cell Coordinates Within The Board
-				2.) number Must Be Between 0 And 9 Inclusive
-				3.) vertices Array Must Be Properly Initialized
-				4.) Texture Atlas Must Have Been Generated With Number Patterns
+				2.) vertices Array Must Be Properly Initialized
 
 			Postconditions:
-				1.) The Four Vertices Of The Specified Cell Will Have UV Coordinates
-				2.) UV Coordinates Will Map To The Specified Number In The Texture Atlas
-				3.) If number > 9, Function Will Return Without Modification
+				1.) The Specified Cell Will Carry The Normalized Colour
 
 		*/
-		void setNumberUVs(unsigned int row, unsigned int col, unsigned int number)
+		void setColor(unsigned int row, unsigned int col, float r, float g, float b)
 		{
-			if (number > 9) return;
 
-			// Calculate UV Coordinates For The Digit With Padding
-			float digitWidth = 1.0f / CONFIG::SHADER::TEXT_ATLAS::TOTAL_CHARS;
+			CellVertex& cell = this->vertices[row * this->col_count + col];
+			cell.color[0] = Vertex::unorm(r);
+			cell.color[1] = Vertex::unorm(g);
+			cell.color[2] = Vertex::unorm(b);
+
+		}
 
-			// Add Padding Within The Texture Atlas Slot
-			float paddingRatio = 0.0f;  // 20% Padding On Each Side = 60% Character Size
-			float actualDigitWidth = digitWidth * (1.0f - 2.0f * paddingRatio);
-			float paddingWidth = digitWidth * paddingRatio;
 
-			float u1 = number * digitWidth + paddingWidth;
-			float v1 = paddingRatio;  // Top And Bottom Padding
-			float u2 = u1 + actualDigitWidth;
-			float v2 = 1.0f - paddingRatio;
+		/*
 
-			unsigned int vertexIndex = (row * this->col_count + col) * 4;
+			Desc: Fills The Per-Cell Vertex Data, Row-Major, With Hidden Cells.
+			No Positions Or Indices Are Stored: default.vert Derives Each
+			Vertex's Cell And Quad Corner From gl_VertexID And Fetches The
+			Cell's Colour And Glyph From cellTexture.
+
+			Preconditions:
+				1.) vertices Array Must Be Allocated With One Entry Per Cell
+
+			Postconditions:
+				1.) Every Cell Will Be Hidden Coloured With No Glyph
+
+		*/
+		void populateBoard()
+		{
+
+			const CellVertex hidden = { { Vertex::unorm(CONFIG::SHADER::COLORS::MINE_BASE_COLOR_R),
+				Vertex::unorm(CONFIG::SHADER::COLORS::MINE_BASE_COLOR_G), Vertex::unorm(CONFIG::SHADER::COLORS::MINE_BASE_COLOR_B) }, Vertex::NO_GLYPH };
+
+			std::fill(this->vertices, this->vertices + static_cast<size_t>(this->row_count) * this->col_count, hidden);
 
-			// Apply The Padded UV Coordinates
-			this->vertices[vertexIndex + 0].uvs[0] = u2; this->vertices[vertexIndex + 0].uvs[1] = v1; // Bottom Right
-			this->vertices[vertexIndex + 1].uvs[0] = u2; this->vertices[vertexIndex + 1].uvs[1] = v2; // Top Right  
-			this->vertices[vertexIndex + 2].uvs[0] = u1; this->vertices[vertexIndex + 2].uvs[1] = v2; // Top Left
-			this->vertices[vertexIndex + 3].uvs[0] = u1; this->vertices[vertexIndex + 3].uvs[1] = v1; // Bottom Left
-	
 		}
 
 
 		/*
 
-			Desc: Creates And Initializes The Minesweeper Board By Allocating Memory
-			For Cells And Setting Up Vertex Data For Each Cell's Quad Geometry.
+			Desc: Builds The Optional Shared Index Buffer: Two Triangles For Each
+			Of INDEX_BATCH_CELLS Cells In 16-Bit Indices. Every Batch Of Visible
+			Cells Reuses It Through A Base Vertex, So Its Size Does Not Depend On
+			The Board, And Indexing Lets The Post-Transform Cache Run The Vertex
+			Shader Four Times Per Cell Instead Of Six.
 
 			Preconditions:
-				1.) width, height, xOffset, yOffset Must Be Initialized
-				2.) row_count And col_count Must Be Valid Board Dimensions
-				3.) vertices And indices Arrays Must Be Allocated
+				1.) packedVAO Must Be Bound, As It Records The Element Buffer
 
 			Postconditions:
-				1.) cells 2D Array Will Be Allocated And Initialized
-				2.) vertices Array Will Contain Quad Geometry For Each Cell
-				3.) indices Array Will Contain Triangle Indices For Rendering
-				4.) Each Cell Will Have Its vboOffset Set Correctly
+				1.) EBO Will Hold The Index Pattern And Be Bound To packedVAO
 
 		*/
-		void populateBoard()
+		void createSharedIndices()
 		{
-			this->cells = new Cell * [this->row_count];
 
-			// Calculate Cell Dimensions
-			float cellWidth = this->width / this->col_count;
-			float cellHeight = this->height / this->row_count;
+			std::vector<unsigned short> pattern(INDEX_BATCH_CELLS * 6);
 
-			for (unsigned int i = 0; i < this->row_count; ++i)
+			for (unsigned int cell = 0; cell < INDEX_BATCH_CELLS; ++cell)
 			{
-				this->cells[i] = new Cell[this->col_count];
+				unsigned short vertex = static_cast<unsigned short>(cell * 4);
+
+				pattern[cell * 6 + 0] = vertex + 0;
+				pattern[cell * 6 + 1] = vertex + 1;
+				pattern[cell * 6 + 2] = vertex + 3;
+				pattern[cell * 6 + 3] = vertex + 1;
+				pattern[cell * 6 + 4] = vertex + 2;
+				pattern[cell * 6 + 5] = vertex + 3;
+			}
+
+			glGenBuffers(1, &this->EBO);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->EBO);
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned short) * pattern.size(), pattern.data(), GL_STATIC_DRAW);
+
+		}
+
+
+		/*
+		
+			Desc: Updates The Visual Appearance Of A Cell Based On Its Type
+			Setting Appropriate Colors And Textures For Mines, Numbers, Or Empty Cells.
+
+			Preconditions:
+				1.) row And col Must Be Valid Cell Coordinates
+				2.) vertices Array Must Be Properly Initialized
+				3.) engine Must Contain Valid Cell Data
+
+			Postconditions:
+				1.) The Cell Will Have Its Color Updated Based On Cell Type
+				2.) Mine Cells Will Be Colored Red
+				3.) Cells With Adjacent Mines Will Be Light Gray With Number Texture
+				4.) Empty Safe Cells Will Be Colored White
+
+		*/
+		void colorCell(unsigned int row, unsigned int col)
+		{
 
-				for (unsigned int j = 0; j < this->col_count; ++j)
+			// Change Color Based On Cell Type
+			if (this->engine.isMine(row, col))
+			{
+				// Red For Mines
+				this->setColor(row, col, 1.0f, 0.0f, 0.0f);
+			}
+			else if (this->engine.getState(row, col) == Engine::CellState::FLAGGED)
+			{
+				// Yellow For Flagged Cells
+				this->setColor(row, col, 1.0f, 1.0f, 0.0f);
+				this->setGlyph(row, col, CONFIG::SHADER::TEXT_ATLAS::FLAG_INDEX);
+			}
+			else
+			{
+				if (this->engine.getAdjacentMines(row, col) > 0)
+				{
+					// Dark White For Safe Cells
+					this->setColor(row, col, 0.9f, 0.9f, 0.9f);
+					this->setGlyph(row, col, static_cast<unsigned char>(this->engine.getAdjacentMines(row, col)));
+				}
+				else
 				{
-					// Use Cell Dimensions For Positioning
-					float x = this->xOffset + j * cellWidth;
-					float y = this->yOffset + i * cellHeight;
-					unsigned int vertexIndex = (i * this->col_count + j) * 4;
-					unsigned int indexIndex = (i * this->col_count + j) * 6;
-					this->cells[i][j].vboOffset = vertexIndex;
-
-					// Define Vertices Using Cell Dimensions
-					this->vertices[vertexIndex + 0] = { { x + cellWidth, y + cellHeight, 0.0f }, { CONFIG::SHADER::COLORS::MINE_BASE_COLOR_R,
-								   CONFIG::SHADER::COLORS::MINE_BASE_COLOR_G,
-								   CONFIG::SHADER::COLORS::MINE_BASE_COLOR_B },
-								   { 0.0f, 0.0f } }; // Top Right
-					this->vertices[vertexIndex + 1] = { { x + cellWidth, y, 0.0f },  { CONFIG::SHADER::COLORS::MINE_BASE_COLOR_R,
-								   CONFIG::SHADER::COLORS::MINE_BASE_COLOR_G,
-								   CONFIG::SHADER::COLORS::MINE_BASE_COLOR_B },
-								   { 0.0f, 0.0f } }; // Bottom Right
-					this->vertices[vertexIndex + 2] = { { x, y, 0.0f },  { CONFIG::SHADER::COLORS::MINE_BASE_COLOR_R,
-								   CONFIG::SHADER::COLORS::MINE_BASE_COLOR_G,
-								   CONFIG::SHADER::COLORS::MINE_BASE_COLOR_B },
-								   { 0.0f, 0.0f } }; // Bottom Left
-					this->vertices[vertexIndex + 3] = { { x, y + cellHeight, 0.0f },  { CONFIG::SHADER::COLORS::MINE_BASE_COLOR_R,
-								   CONFIG::SHADER::COLORS::MINE_BASE_COLOR_G,
-								   CONFIG::SHADER::COLORS::MINE_BASE_COLOR_B },
-								   { 0.0f, 0.0f } }; // Top Left
-
-					// Indices Remain The Same
-					this->indices[indexIndex + 0] = vertexIndex + 0;
-					this->indices[indexIndex + 1] = vertexIndex + 1;
-					this->indices[indexIndex + 2] = vertexIndex + 3;
-					this->indices[indexIndex + 3] = vertexIndex + 1;
-					this->indices[indexIndex + 4] = vertexIndex + 2;
-					this->indices[indexIndex + 5] = vertexIndex + 3;
+					// White For Safe Cells
+					this->setColor(row, col, 1.0f, 1.0f, 1.0f);
 				}
 			}
 
 		}
 
-		unsigned int linesOffset;
 
 		/*
-		
-			Desc: Generates Grid Line Geometry To Create Visual Separation Between
-			Minesweeper Cells For Better Game Visibility.
+
+			Desc: Marks A Cell As Needing Upload. The Bitmap Keeps
+			Each Cell In The Dirty List Once No Matter How Often It Changes.
 
 			Preconditions:
-				1.) width, height, xOffset, yOffset Must Be Initialized
-				2.) row_count And col_count Must Be Valid Board Dimensions
-				3.) vertices And indices Arrays Must Be Allocated With Sufficient Space
+				1.) index Must Be A Valid Linear Cell Index
+				2.) dirtyBits Must Be Sized To The Board
 
 			Postconditions:
-				1.) linesOffset Will Be Set To The Starting Index For Grid Lines
-				2.) vertices Array Will Contain Line Geometry After Cell Data
-				3.) indices Array Will Contain Line Indices For Rendering Grid
-				4.) Both Horizontal And Vertical Grid Lines Will Be Generated
+				1.) index Will Be In dirtyCells Exactly Once
 
 		*/
-		void generateGridLines()
+		void markDirty(unsigned int index)
 		{
 
-			// Set Where We Start Writing Grid Lines In The Vertex Buffer
-			this->linesOffset = this->row_count * this->col_count * 4;
+			uint64_t bit = 1ULL << (index % 64);
 
-			float cellWidth = this->width / this->col_count;
-			float cellHeight = this->height / this->row_count;
+			if (!(this->dirtyBits[index / 64] & bit))
+			{
+				this->dirtyBits[index / 64] |= bit;
+				this->dirtyCells.push_back(index);
+			}
 
-			unsigned int currentVertexIndex = this->linesOffset;
-			unsigned int currentIndexOffset = this->row_count * this->col_count * 6;
+		}
 
-			// Vertical Lines
-			for (unsigned int i = 0; i <= this->col_count; ++i)
-			{
-				float x = this->xOffset + i * cellWidth;
-				float yStart = this->yOffset;
-				float yEnd = this->yOffset + this->height;
 
-				this->vertices[currentVertexIndex] = { { x, yStart, 0.0f }, { 0.1f, 0.1f, 0.1f }, {0.0f, 0.0f} };
-				this->vertices[currentVertexIndex + 1] = { { x, yEnd, 0.0f }, { 0.1f, 0.1f, 0.1f }, {0.0f, 0.0f} };
+		/*
 
-				this->indices[currentIndexOffset] = currentVertexIndex;
-				this->indices[currentIndexOffset + 1] = currentVertexIndex + 1;
+			Desc: Brings The Vertex Data Of Every Cell The Engine Reports As
+			Changed In Line With Its New State, Then Clears The Change List.
 
-				currentVertexIndex += 2;
-				currentIndexOffset += 2;
-			}
+			Preconditions:
+				1.) vertices Array Must Be Properly Initialized
+				2.) engine Must Be Properly Initialized
+
+			Postconditions:
+				1.) Hidden Cells Will Have Default Visuals (Vertex Mode)
+				2.) Revealed And Flagged Cells Will Be Colored Through colorCell (Vertex Mode)
+				3.) Every Changed Cell Will Be Marked Dirty For The Next Upload, And
+				    Queued In The LOD Pyramid
+				4.) The Engine's Change List Will Be Empty
 
-			// Horizontal Lines
-			for (unsigned int i = 0; i <= this->row_count; ++i)
+		*/
+		void applyChanges()
+		{
+
+			for (unsigned int index : this->engine.getChangedCells())
 			{
-				float y = this->yOffset + i * cellHeight;
-				float xStart = this->xOffset;
-				float xEnd = this->xOffset + this->width;
+				// Packed Cell Renderers Draw Straight From The Engine's Bytes
+				if (this->renderer == CellRenderer::VERTICES)
+				{
+					unsigned int row = index / this->col_count;
+					unsigned int col = index % this->col_count;
 
-				this->vertices[currentVertexIndex] = { { xStart, y, 0.0f }, { 0.1f, 0.1f, 0.1f }, {0.0f, 0.0f} };
-				this->vertices[currentVertexIndex + 1] = { { xEnd, y, 0.0f }, { 0.1f, 0.1f, 0.1f }, {0.0f, 0.0f} };
+					if (this->engine.getState(row, col) == Engine::CellState::HIDDEN)
+					{
+						this->resetCellVisuals(row, col);
+					}
+					else
+					{
+						this->colorCell(row, col);
+					}
+				}
 
-				this->indices[currentIndexOffset] = currentVertexIndex;
-				this->indices[currentIndexOffset + 1] = currentVertexIndex + 1;
+				this->markDirty(index);
 
-				currentVertexIndex += 2;
-				currentIndexOffset += 2;
+				if (this->lodTexture != 0)
+				{
+					this->lod.markCell(index / this->col_count, index % this->col_count);
+				}
 			}
 
+			this->engine.clearChanges();
+
 		}
 
 
+
 		/*
-		
-			Desc: Resets All Cells On The Board To Their Default Hidden State
-			Clearing All Mine And Adjacent Count Data.
+
+			Desc: Sets The Board Constants Shared By Every Cell Mode, Once.
 
 			Preconditions:
-				1.) cells Array Must Be Properly Allocated And Initialized
-				2.) row_count And col_count Must Be Valid Board Dimensions
+				1.) shader Must Be The Active Program
 
 			Postconditions:
-				1.) All Cells Will Have state Set To CellState::HIDDEN
-				2.) All Cells Will Have adjacentMines Reset To 0
-				3.) All Cells Will Have isMine Set To false
+				1.) Board Constant Uniforms Will Have Been Set Once
 
 		*/
-		void resetBoard()
+		void setBoardUniforms(const Shader& shader)
 		{
 
-			for (unsigned int i = 0; i < this->row_count; ++i)
+			if (this->uniformsSet)
 			{
-				for (unsigned int j = 0; j < this->col_count; ++j)
-				{
-					this->cells[i][j].state = CellState::HIDDEN;
-					this->cells[i][j].adjacentMines = 0;
-					this->cells[i][j].isMine = false;
-				}
+				return;
+			}
+
+			GLState& gl = GLState::get();
+
+			gl.call(glUniform2f, shader.getUniform("boardOrigin"), this->xOffset, this->yOffset);
+			gl.call(glUniform2f, shader.getUniform("cellSize"), this->width / this->col_count, this->height / this->row_count);
+			gl.call(glUniform2ui, shader.getUniform("boardDims"), this->col_count, this->row_count);
+			gl.call(glUniform3f, shader.getUniform("hiddenColor"), CONFIG::SHADER::COLORS::MINE_BASE_COLOR_R,
+				CONFIG::SHADER::COLORS::MINE_BASE_COLOR_G, CONFIG::SHADER::COLORS::MINE_BASE_COLOR_B);
+			gl.call(glUniform3f, shader.getUniform("gridColor"), CONFIG::SHADER::COLORS::GRID_COLOR_R,
+				CONFIG::SHADER::COLORS::GRID_COLOR_G, CONFIG::SHADER::COLORS::GRID_COLOR_B);
+			gl.call(glUniform1f, shader.getUniform("atlasSlot"), 1.0f / CONFIG::SHADER::TEXT_ATLAS::TOTAL_CHARS);
+			gl.call(glUniform1f, shader.getUniform("flagGlyph"), static_cast<float>(CONFIG::SHADER::TEXT_ATLAS::FLAG_INDEX));
+			gl.call(glUniform1ui, shader.getUniform("stateWidth"), this->stateWidth);
+			gl.call(glUniform1ui, shader.getUniform("cellVertices"), CONFIG::BOARD::SHARED_INDICES ? 4u : 6u);
+
+			if (this->lodTexture != 0)
+			{
+				float span = static_cast<float>(1u << this->lod.getBaseLevel());
+
+				gl.call(glUniform1f, shader.getUniform("lodBase"), static_cast<float>(this->lod.getBaseLevel()));
+				gl.call(glUniform2f, shader.getUniform("lodScale"), 1.0f / (span * this->lod.getWidth(0)), 1.0f / (span * this->lod.getHeight(0)));
 			}
 
+			this->uniformsSet = true;
+
 		}
 
 
 		/*
-		
-			Desc: Randomly Places Mines On The Board And Calculates Adjacent Mine
-			Counts For All Non-Mine Cells.
+
+			Desc: Brings Everything That Depends On The View Up To Date: The
+			viewProjection Uniform, gridMargin (One Pixel In Cells At The
+			Current Zoom, So The Outline Vertices Can Overhang The Board For The
+			Outer Lines), And The Culled Draw Ranges. Vertex Mode Numbers The
+			Visible Cell Rectangle From viewOrigin, viewColumns Cells Per Row,
+			So One Draw Covers Exactly The Cells In View (Split Into Shared
+			Index Batches When SHARED_INDICES Is Set); Instanced Mode Narrows
+			Its Instances To The Visible Row Band By Rebasing The Cell Byte
+			Attribute. The State Texture Quad Needs No
+			Culling As Its Cost Is Already Per Pixel. Once Cells Shrink Below
+			CONFIG::BOARD::LOD_CELL_PIXELS The Overview Quad Replaces Them.
 
 			Preconditions:
-				1.) cells Array Must Be Properly Allocated And Initialized
-				2.) row_count, col_count, And mineCount Must Be Valid
-				3.) Random Number Generator Must Be Seeded
+				1.) shader Must Be The Active Program
+				2.) Board Must Be Properly Initialized
 
 			Postconditions:
-				1.) Mines Will Be Randomly Distributed Across The Board
-				2.) Each Non-Mine Cell Will Have Correct adjacentMines Count
-				3.) All Cells Adjacent To Mines Will Have Their Count Updated
+				1.) View Uniforms And Draw Ranges Will Match camera
+				2.) visibleCells Will Count The Cells The Next Draw Covers
+				3.) useLod Will Be Set If Cells Are Too Small To Draw One By One
 
 		*/
-		void loadBoard()
+		void updateView(const Shader& shader, const Camera& camera)
 		{
 
-			for (unsigned int i = 0; i < this->row_count; ++i)
+			GLState& gl = GLState::get();
+			float cellWidth = this->width / this->col_count;
+			float cellHeight = this->height / this->row_count;
+
+			gl.call(glUniformMatrix4fv, shader.getUniform("viewProjection"), 1, GL_FALSE, &camera.getViewProjection()[0][0]);
+			gl.call(glUniform2f, shader.getUniform("gridMargin"), 2.0f / this->viewportWidth / (cellWidth * camera.getZoom()),
+				2.0f / this->viewportHeight / (cellHeight * camera.getZoom()));
+
+			float cellPixels = std::min(cellWidth * this->viewportWidth, cellHeight * this->viewportHeight) * 0.5f * camera.getZoom();
+			this->useLod = this->lodTexture != 0 && cellPixels < CONFIG::BOARD::LOD_CELL_PIXELS;
+
+			// Visible Cell Rectangle, Clamped To The Board
+			glm::vec2 low = (camera.getVisibleMin() - glm::vec2(this->xOffset, this->yOffset)) / glm::vec2(cellWidth, cellHeight);
+			glm::vec2 high = (camera.getVisibleMax() - glm::vec2(this->xOffset, this->yOffset)) / glm::vec2(cellWidth, cellHeight);
+
+			this->drawCounts.clear();
+			this->drawOffsets.clear();
+			this->drawBaseVertices.clear();
+			this->visibleCells = 0;
+
+			if (high.x < 0.0f || high.y < 0.0f || low.x >= this->col_count || low.y >= this->row_count)
+			{
+				return;
+			}
+
+			unsigned int col0 = static_cast<unsigned int>(std::max(low.x, 0.0f));
+			unsigned int row0 = static_cast<unsigned int>(std::max(low.y, 0.0f));
+			unsigned int col1 = std::min(static_cast<unsigned int>(high.x), this->col_count - 1);
+			unsigned int row1 = std::min(static_cast<unsigned int>(high.y), this->row_count - 1);
+
+			if (this->renderer == CellRenderer::VERTICES)
 			{
-				for (unsigned int j = 0; j < this->col_count; ++j)
+				this->visibleCells = static_cast<size_t>(row1 - row0 + 1) * (col1 - col0 + 1);
+
+				gl.call(glUniform2ui, shader.getUniform("viewOrigin"), col0, row0);
+				gl.call(glUniform1ui, shader.getUniform("viewColumns"), col1 - col0 + 1);
+
+				// gl_VertexID Includes The Base Vertex, So Each Batch Picks Up Where The Last Ended
+				for (size_t first = 0; CONFIG::BOARD::SHARED_INDICES && first < this->visibleCells; first += INDEX_BATCH_CELLS)
 				{
-					if (std::rand() / (float)RAND_MAX < (static_cast<float>(this->mineCount) / (this->row_count * this->col_count)))
-					{
-						this->cells[i][j].isMine = true;
-
-						// Update Adjacent Cells
-						for (int di = -1; di <= 1; ++di)
-						{
-							for (int dj = -1; dj <= 1; ++dj)
-							{
-								int ni = i + di;
-								int nj = j + dj;
-
-								if (ni >= 0 && ni < this->row_count && nj >= 0 && nj < this->col_count && !(di == 0 && dj == 0))
-								{
-									this->cells[ni][nj].adjacentMines++;
-								}
-							}
-						}
-					}
+					this->drawCounts.push_back(static_cast<GLsizei>(std::min<size_t>(this->visibleCells - first, INDEX_BATCH_CELLS) * 6));
+					this->drawOffsets.push_back(nullptr);
+					this->drawBaseVertices.push_back(static_cast<GLint>(first * 4));
 				}
 			}
+			else if (this->renderer == CellRenderer::INSTANCED)
+			{
+				this->firstInstance = static_cast<size_t>(row0) * this->col_count;
+				this->visibleCells = static_cast<size_t>(row1 - row0 + 1) * this->col_count;
+
+				// Instance 0 Reads The Band's First Byte; The Shader Adds The Base Back For Its Position
+				gl.bindVertexArray(this->packedVAO);
+				gl.bindArrayBuffer(this->stateVBO);
+				gl.call(glVertexAttribIPointer, 3, 1, GL_UNSIGNED_BYTE, 1, reinterpret_cast<const void*>(this->firstInstance));
+				gl.call(glUniform1ui, shader.getUniform("instanceBase"), static_cast<GLuint>(this->firstInstance));
+			}
+			else
+			{
+				this->visibleCells = static_cast<size_t>(row1 - row0 + 1) * (col1 - col0 + 1);
+			}
 
 		}
 
 
 		/*
-		
-			Desc: Implements A Flood Fill Algorithm To Automatically Reveal
-			Connected Empty Cells When A Cell With No Adjacent Mines Is Clicked.
+
+			Desc: Draws The Cells From Their Packed Engine Bytes. Instanced Mode
+			Draws One Unit Quad Strip Per Cell Of The Visible Row Band, Fetching
+			Each Byte From stateVBO; State Texture Mode Draws A Single Quad Over
+			The Whole Board Whose Fragment Shader Looks Each Pixel's Cell Up In
+			stateTexture. Corners Come From gl_VertexID In Both Cases.
 
 			Preconditions:
-				1.) row And col Must Be Valid Cell Coordinates
-				2.) cells Array Must Be Properly Initialized
-				3.) visited Array Must Be Available For Tracking
+				1.) stateVBO Or stateTexture Must Hold Current Cell Bytes
+				2.) shader Must Be The Active Program With Board And View Uniforms Set
 
 			Postconditions:
-				1.) All Connected Empty Cells Will Be Revealed
-				2.) Cells With Adjacent Mines Will Be Revealed But Not Expanded
-				3.) visited Array Will Track All Processed Cells
-				4.) Cell Colors Will Be Updated For All Revealed Cells
+				1.) The Visible Cells Will Be Drawn In One Call From packedVAO
 
 		*/
-		void bloomOut(unsigned int row, unsigned int col)
+		void renderPackedCells(const Shader& shader)
 		{
 
-			if (this->cells[row][col].adjacentMines > 0 || this->cells[row][col].isMine)
+			GLState& gl = GLState::get();
+			bool textured = this->renderer == CellRenderer::STATE_TEXTURE;
+
+			gl.call(glUniform1i, shader.getUniform("cellMode"), textured ? 2 : 1);
+			gl.bindVertexArray(this->packedVAO);
+
+			if (textured)
 			{
-				return; // Only Bloom Out From Cells With 0 Adjacent Mines
+				gl.bindTexture(1, this->stateTexture);
+				gl.call(glDrawArrays, GL_TRIANGLE_STRIP, 0, 4);
 			}
+			else if (this->visibleCells > 0)
+			{
+				gl.call(glDrawArraysInstanced, GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(this->visibleCells));
+			}
+
+		}
 
-			std::stack<std::pair<unsigned int, unsigned int>> toVisit;
 
-			// Start From All Revealed Cells With 0 Adjacent Mines
-			toVisit.push({ row, col });
-			visited[row][col] = true;
+		/*
+
+			Desc: Sends count Cells Starting At Cell first To The GPU In The
+			Active Renderer's Format: One CellVertex Per Cell Into VBO, Or One
+			Engine Byte Per Cell Into stateVBO Or stateTexture. A Run Crossing
+			Texture Rows Is Split Into Whole-Row And Partial-Row Blocks.
 
-			while (!toVisit.empty())
+			Preconditions:
+				1.) The Target Buffer Must Be Bound To GL_ARRAY_BUFFER (Buffer Modes),
+				    Or stateTexture Selected On Its Unit (Texture Mode)
+				2.) [first, first + count) Must Be Valid Cell Indices
+
+			Postconditions:
+				1.) The Cells Will Be Current On The GPU
+				2.) Their Size In Bytes Will Be Added To lastUploadBytes
+
+		*/
+		void uploadCells(size_t first, size_t count)
+		{
+
+			if (this->renderer != CellRenderer::STATE_TEXTURE)
 			{
-				std::pair<unsigned int, unsigned int> current = toVisit.top();
-				toVisit.pop();
+				const size_t cellBytes = this->renderer == CellRenderer::INSTANCED ? 1 : sizeof(CellVertex);
+				const unsigned char* source = this->renderer == CellRenderer::INSTANCED ? this->engine.getCells() : reinterpret_cast<const unsigned char*>(this->vertices);
 
-				unsigned int r = current.first;
-				unsigned int c = current.second;
-				this->cells[r][c].state = CellState::REVEALED;
-				this->colorCell(r, c);
+				GLState::get().call(glBufferSubData, GL_ARRAY_BUFFER, static_cast<GLintptr>(cellBytes * first), static_cast<GLsizeiptr>(cellBytes * count), source + cellBytes * first);
+				this->lastUploadBytes += cellBytes * count;
+				return;
+			}
+
+			const unsigned char* cells = this->engine.getCells();
+			this->lastUploadBytes += count;
 
-				for (int dr = -1; dr <= 1; ++dr)
+			while (count > 0)
+			{
+				unsigned int x = static_cast<unsigned int>(first % this->stateWidth);
+				unsigned int y = static_cast<unsigned int>(first / this->stateWidth);
+				size_t sent;
+
+				if (x == 0 && count >= this->stateWidth)
 				{
-					for (int dc = -1; dc <= 1; ++dc)
-					{
-						int nr = r + dr;
-						int nc = c + dc;
-
-						if (nr >= 0 && nr < this->row_count && nc >= 0 && nc < this->col_count && !visited[nr][nc])
-						{
-							visited[nr][nc] = true;
-
-							if (this->cells[nr][nc].state == CellState::HIDDEN && this->cells[nr][nc].adjacentMines == 0 && !this->cells[nr][nc].isMine)
-							{
-								toVisit.push({ nr, nc });
-							}
-						}
-					}
+					unsigned int rows = static_cast<unsigned int>(count / this->stateWidth);
+					GLState::get().call(glTexSubImage2D, GL_TEXTURE_2D, 0, 0, y, this->stateWidth, rows, GL_RED_INTEGER, GL_UNSIGNED_BYTE, cells + first);
+					sent = static_cast<size_t>(rows) * this->stateWidth;
+				}
+				else
+				{
+					sent = std::min<size_t>(count, this->stateWidth - x);
+					GLState::get().call(glTexSubImage2D, GL_TEXTURE_2D, 0, x, y, static_cast<GLsizei>(sent), 1, GL_RED_INTEGER, GL_UNSIGNED_BYTE, cells + first);
 				}
+
+				first += sent;
+				count -= sent;
 			}
 
 		}
 
+
 		/*
-		
-			Desc: Updates The Visual Appearance Of A Cell Based On Its Type
-			Setting Appropriate Colors And Textures For Mines, Numbers, Or Empty Cells.
+
+			Desc: Creates The Integer State Texture Holding One Engine Byte Per
+			Cell. Rows Map To Texture Rows When They Fit; Wider Boards Wrap Their
+			Row-Major Cells At GL_MAX_TEXTURE_SIZE Texels. Boards Too Large Even
+			Then Fall Back To Instanced Rendering.
 
 			Preconditions:
-				1.) row And col Must Be Valid Cell Coordinates
-				2.) vertices Array Must Be Properly Initialized
-				3.) cells Array Must Contain Valid Cell Data
+				1.) The Engine Must Hold The Current Board
+				2.) OpenGL Context Must Be Active
 
 			Postconditions:
-				1.) Cell Vertices Will Have Colors Updated Based On Cell Type
-				2.) Mine Cells Will Be Colored Red
-				3.) Cells With Adjacent Mines Will Be Light Gray With Number Texture
-				4.) Empty Safe Cells Will Be Colored White
+				1.) stateTexture Will Hold Every Cell And Be Bound To Texture Unit 1,
+				    Or renderer Will Be Switched To INSTANCED
 
 		*/
-		void colorCell(unsigned int row, unsigned int col)
+		void createStateTexture()
 		{
 
-			// Update Vertex Colors For Visual Feedback
-			unsigned int vertexIndex = (row * this->col_count + col) * 4;
+			GLint maxSize = 0;
+			glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
 
-			// Change Color Based On Cell Type
-			if (this->cells[row][col].isMine)
+			size_t cellCount = static_cast<size_t>(this->row_count) * this->col_count;
+			size_t width = std::min<size_t>(this->col_count, static_cast<size_t>(maxSize));
+			size_t height = (cellCount + width - 1) / width;
+
+			if (height > static_cast<size_t>(maxSize))
 			{
-				// Red For Mines
-				for (int i = 0; i < 4; ++i)
-				{
-					this->vertices[vertexIndex + i].color[0] = 1.0f;
-					this->vertices[vertexIndex + i].color[1] = 0.0f;
-					this->vertices[vertexIndex + i].color[2] = 0.0f;
-				}
+				std::cerr << "Board Is Too Large For A State Texture, Using Instanced Cells...\n";
+				this->renderer = CellRenderer::INSTANCED;
+				return;
 			}
-			else if (this->cells[row][col].state == CellState::FLAGGED)
+
+			this->stateWidth = static_cast<unsigned int>(width);
+			this->stateHeight = static_cast<unsigned int>(height);
+
+			glGenTextures(1, &this->stateTexture);
+			GLState::get().selectTexture(1, this->stateTexture);
+
+			// Integer Textures Cannot Be Filtered
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_R8UI, this->stateWidth, this->stateHeight, 0, GL_RED_INTEGER, GL_UNSIGNED_BYTE, nullptr);
+			this->uploadCells(0, cellCount);
+
+		}
+
+
+		/*
+
+			Desc: Builds The LOD Pyramid And Uploads It As A Mipmapped RGBA8
+			Texture, One Mip Level Per Pyramid Level. Level 0 Is Capped At
+			CONFIG::BOARD::LOD_MAX_SIZE Texels (Or GL_MAX_TEXTURE_SIZE), So Huge
+			Boards Start A Few Levels Up With Each Texel Already Covering A Block
+			Of Cells.
+
+			Preconditions:
+				1.) The Engine Must Hold The Current Board
+				2.) OpenGL Context Must Be Active
+
+			Postconditions:
+				1.) lodTexture Will Hold Every Pyramid Level And Be Bound To Texture Unit 2
+
+		*/
+		void createLodTexture()
+		{
+
+			GLint maxSize = 0;
+			glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+
+			unsigned int side = 1;
+			while (side * 2 <= std::min<unsigned int>(CONFIG::BOARD::LOD_MAX_SIZE, static_cast<unsigned int>(maxSize)))
 			{
-				// Yellow For Flagged Cells
-				for (int i = 0; i < 4; ++i)
-				{
-					this->vertices[vertexIndex + i].color[0] = 1.0f;
-					this->vertices[vertexIndex + i].color[1] = 1.0f;
-					this->vertices[vertexIndex + i].color[2] = 0.0f;
-				}
-				this->setFlagUVs(row, col);
+				side *= 2;
 			}
-			else
+
+			this->lod.build(this->engine, side);
+
+			glGenTextures(1, &this->lodTexture);
+			GLState::get().selectTexture(2, this->lodTexture);
+
+			// Trilinear, So The Shader Can Pick A Fractional Level Per Pixel
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, this->lod.getLevelCount() - 1);
+			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+			for (unsigned int level = 0; level < this->lod.getLevelCount(); ++level)
 			{
-				if (this->cells[row][col].adjacentMines > 0)
-				{
-					// Dark White For Safe Cells
-					for (int i = 0; i < 4; ++i)
-					{
-						this->vertices[vertexIndex + i].color[0] = 0.9f;
-						this->vertices[vertexIndex + i].color[1] = 0.9f;
-						this->vertices[vertexIndex + i].color[2] = 0.9f;
-					}
-					this->setNumberUVs(row, col, this->cells[row][col].adjacentMines);
-				}
-				else
+				glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, this->lod.getWidth(level), this->lod.getHeight(level), 0,
+					GL_RGBA, GL_UNSIGNED_BYTE, this->lod.getLevel(level));
+			}
+
+			this->lod.clearDirty();
+
+		}
+
+
+		/*
+
+			Desc: Recomputes The Pyramid Texels Queued Since The Last Upload And
+			Sends Each Level's Changed Rectangle With One glTexSubImage2D, So A
+			Click Costs A Handful Of Texels Per Level Rather Than A Rebuild.
+
+			Preconditions:
+				1.) lodTexture Must Have Been Created
+				2.) OpenGL Context Must Be Active
+
+			Postconditions:
+				1.) lodTexture Will Match The Engine's Cells
+				2.) The Bytes Sent Will Be Added To lastUploadBytes
+
+		*/
+		void uploadLod()
+		{
+
+			GLState& gl = GLState::get();
+			this->lod.refresh(this->engine);
+
+			for (unsigned int level = 0; level < this->lod.getLevelCount(); ++level)
+			{
+				const LodPyramid::Rect& rect = this->lod.getDirty(level);
+
+				if (rect.empty())
 				{
-					// White For Safe Cells
-					for (int i = 0; i < 4; ++i)
-					{
-						this->vertices[vertexIndex + i].color[0] = 1.0f;
-						this->vertices[vertexIndex + i].color[1] = 1.0f;
-						this->vertices[vertexIndex + i].color[2] = 1.0f;
-					}
+					continue;
 				}
+
+				unsigned int levelWidth = this->lod.getWidth(level);
+				const unsigned char* source = this->lod.getLevel(level) + (static_cast<size_t>(rect.y0) * levelWidth + rect.x0) * LodPyramid::CHANNELS;
+
+				gl.selectTexture(2, this->lodTexture);
+				gl.call(glPixelStorei, GL_UNPACK_ROW_LENGTH, static_cast<GLint>(levelWidth));
+				gl.call(glTexSubImage2D, GL_TEXTURE_2D, static_cast<GLint>(level), rect.x0, rect.y0, rect.x1 - rect.x0, rect.y1 - rect.y0,
+					GL_RGBA, GL_UNSIGNED_BYTE, source);
+				gl.call(glPixelStorei, GL_UNPACK_ROW_LENGTH, 0);
+
+				this->lastUploadBytes += static_cast<size_t>(rect.x1 - rect.x0) * (rect.y1 - rect.y0) * LodPyramid::CHANNELS;
 			}
 
+			this->lod.clearDirty();
+
 		}
 
 
@@ -732,7 +780,7 @@ class Board
 			const unsigned int& col_count = CONFIG::BOARD::COL_COUNT,
 			const unsigned int& mineCount = CONFIG::BOARD::MINE_COUNT) :
 			width(width), height(height), xOffset(xOffset), yOffset(yOffset),
-			row_count(row_count), col_count(col_count), mineCount(mineCount)
+			engine(row_count, col_count, mineCount), row_count(row_count), col_count(col_count)
 		{
 		}
 
@@ -744,49 +792,31 @@ class Board
 
 			Preconditions:
 				1.) row And col Must Be Valid Cell Coordinates
-				2.) cells Array Must Be Properly Initialized
+				2.) engine Must Be Properly Initialized
 				3.) Cell Must Not Be In FLAGGED State
 
 			Postconditions:
 				1.) If Cell Is A Mine, All Mines Will Be Revealed And Game Over Triggered
 				2.) If Cell Is Safe, It Will Be Revealed With Appropriate Visual Updates
-				3.) If Cell Is Empty, bloomOut Will Be Called For Flood Fill
-				4.) Vertex Buffer Will Be Updated If Mine Is Hit
+				3.) If Cell Is Empty, The Engine Will Flood Fill The Open Region
+				4.) A Win Will Be Reported When The Last Safe Cell Is Revealed
 
 		*/
 		void updateCell(unsigned int row, unsigned int col)
 		{
 
-			if (this->cells[row][col].state == CellState::FLAGGED)
-			{
-				return; // Ignore Clicks On Revealed Or Flagged Cells
-			}
+			bool wasPlaying = this->engine.getGameState() == Engine::GameState::PLAYING;
+			bool hitMine = this->engine.reveal(row, col);
 
-			if (this->cells[row][col].isMine)
+			this->applyChanges();
+
+			if (hitMine)
 			{
-				// Reveal All Mines
-				for (unsigned int i = 0; i < this->row_count; ++i)
-				{
-					for (unsigned int j = 0; j < this->col_count; ++j)
-					{
-						if (this->cells[i][j].isMine)
-						{
-							this->cells[i][j].state = CellState::REVEALED;
-							this->colorCell(i, j);
-						}
-					}
-				}
-				this->updateVertexBuffer();
 				std::cout << "Game Over! You clicked on a mine at (" << row << ", " << col << ").\n";
-				return;
 			}
-
-			// Update Cell State
-			if (this->cells[row][col].state == CellState::HIDDEN)
+			else if (wasPlaying && this->engine.getGameState() == Engine::GameState::WON)
 			{
-				this->cells[row][col].state = CellState::REVEALED;
-				this->bloomOut(row, col);
-				this->colorCell(row, col);
+				std::cout << "You Win! Every Safe Cell Has Been Revealed.\n";
 			}
 
 		}
@@ -794,11 +824,12 @@ class Board
 
 		/*
 		
-			Desc: Processes Mouse Clicks On The Board, Converting Screen Coordinates
+			Desc: Processes Mouse Clicks On The Board, Converting World Coordinates
 			To Board Coordinates And Handling Left/Right Click Actions.
 
 			Preconditions:
-				1.) normalizedX And normalizedY Must Be In Valid Screen Space
+				1.) worldX And worldY Must Be The Clicked Point In World Space (The
+				    Camera's Inverse Transform Applied To The Cursor)
 				2.) Board Must Be Properly Initialized
 				3.) isRightClick Indicates Left (false) Or Right (true) Click
 
@@ -806,23 +837,25 @@ class Board
 				1.) If Click Is Within Board Bounds, Appropriate Action Will Be Taken
 				2.) Left Click Will Call updateCell For Cell Revelation
 				3.) Right Click Will Call toggleFlag For Flag Management
-				4.) Vertex Buffer Will Be Updated After Any Cell Modification
+				4.) Only The Vertices Of Cells That Changed Will Be Uploaded
+				5.) Returns true If Any Cell Changed (The Board Needs Redrawing)
+				6.) The Click's Update And Upload Will Be Stamped For LatencyTracker
 
 		*/
-		void handleClick(float normalizedX, float normalizedY, bool isRightClick)
+		bool handleClick(float worldX, float worldY, bool isRightClick)
 		{
 
-			// Convert Normalized Coordinates To Board Indices
-			if (normalizedX < this->xOffset || normalizedX > this->xOffset + this->width ||
-				normalizedY < this->yOffset || normalizedY > this->yOffset + this->height)
+			// Convert World Coordinates To Board Indices
+			if (worldX < this->xOffset || worldX > this->xOffset + this->width ||
+				worldY < this->yOffset || worldY > this->yOffset + this->height)
 			{
-				return; // Click Outside The Board
+				return false; // Click Outside The Board
 			}
 
 			float cellWidth = this->width / this->col_count;
 			float cellHeight = this->height / this->row_count;
-			unsigned int col = static_cast<unsigned int>((normalizedX - this->xOffset) / cellWidth);
-			unsigned int row = static_cast<unsigned int>((normalizedY - this->yOffset) / cellHeight);
+			unsigned int col = static_cast<unsigned int>((worldX - this->xOffset) / cellWidth);
+			unsigned int row = static_cast<unsigned int>((worldY - this->yOffset) / cellHeight);
 
 			if (row < this->row_count && col < this->col_count)
 			{
@@ -834,9 +867,16 @@ class Board
 				{
 					this->updateCell(row, col);
 				}
+				LatencyTracker::get().stamp(LatencyTracker::UPDATED);
+
 				this->updateVertexBuffer();
+				LatencyTracker::get().stamp(LatencyTracker::UPLOADED);
+
+				return this->lastUploadBytes > 0;
 			}
 
+			return false;
+
 		}
 
 
@@ -847,7 +887,7 @@ class Board
 
 			Preconditions:
 				1.) row And col Must Be Valid Cell Coordinates
-				2.) cells Array Must Be Properly Initialized
+				2.) engine Must Be Properly Initialized
 				3.) Cell Must Not Be In REVEALED State
 
 			Postconditions:
@@ -859,16 +899,8 @@ class Board
 		void toggleFlag(unsigned int row, unsigned int col)
 		{
 
-			if (this->cells[row][col].state == CellState::HIDDEN)
-			{
-				this->cells[row][col].state = CellState::FLAGGED;
-				this->colorCell(row, col);
-			}
-			else if (this->cells[row][col].state == CellState::FLAGGED)
-			{
-				this->cells[row][col].state = CellState::HIDDEN;
-				this->resetCellVisuals(row, col);
-			}
+			this->engine.toggleFlag(row, col);
+			this->applyChanges();
 
 		}
 	
@@ -884,54 +916,103 @@ class Board
 				3.) CONFIG Color Values Must Be Available
 
 			Postconditions:
-				1.) Cell Vertices Will Be Reset To Default Hidden Cell Colors
-				2.) Cell UV Coordinates Will Be Reset To Default (0,0)
+				1.) The Cell Will Be Reset To The Default Hidden Cell Color
+				2.) Cell Glyph Will Be Cleared
 
 		*/
 		void resetCellVisuals(unsigned int row, unsigned int col)
 		{
 
-			unsigned int vertexIndex = (row * this->col_count + col) * 4;
-
 			// Reset To Default Hidden Cell Color
-			for (int i = 0; i < 4; ++i)
-			{
-				this->vertices[vertexIndex + i].color[0] = CONFIG::SHADER::COLORS::MINE_BASE_COLOR_R;
-				this->vertices[vertexIndex + i].color[1] = CONFIG::SHADER::COLORS::MINE_BASE_COLOR_G;
-				this->vertices[vertexIndex + i].color[2] = CONFIG::SHADER::COLORS::MINE_BASE_COLOR_B;
-			}
+			this->setColor(row, col, CONFIG::SHADER::COLORS::MINE_BASE_COLOR_R,
+				CONFIG::SHADER::COLORS::MINE_BASE_COLOR_G, CONFIG::SHADER::COLORS::MINE_BASE_COLOR_B);
 
-			// Reset UV Coordinates To Default (No Texture)
-			for (int i = 0; i < 4; ++i)
-			{
-				this->vertices[vertexIndex + i].uvs[0] = 0.0f;
-				this->vertices[vertexIndex + i].uvs[1] = 0.0f;
-			}
+			// No Glyph Over Hidden Cells
+			this->setGlyph(row, col, Vertex::NO_GLYPH);
 
 		}
 
 
 		/*
 	
-			Desc: Updates The OpenGL Vertex Buffer Object With Current Vertex Data
-			To Reflect Any Visual Changes Made To The Board.
+			Desc: Uploads Every Dirty Cell To The GPU Through uploadCells. Dirty
+			Cells Are Sorted And Coalesced Into Runs (Bridging Gaps Of Up
+			To DIRTY_MERGE_GAP Clean Cells) With One glBufferSubData Per Run.
+			Past FULL_UPLOAD_RATIO Of The Board All Cell Data Is Sent In A
+			Single Call Instead.
 
 			Preconditions:
-				1.) VBO Must Be A Valid OpenGL Buffer Object
-				2.) vertices Array Must Contain Current Vertex Data
+				1.) The Active Renderer's Buffer Or Texture Must Have Been Created
+				2.) vertices Array Must Contain Current Vertex Data (Vertex Mode)
 				3.) OpenGL Context Must Be Active
 
 			Postconditions:
-				1.) GPU Vertex Buffer Will Be Updated With Current Vertex Data
-				2.) All Visual Changes Will Be Ready For Next Render Call
+				1.) GPU Cell Data Will Match The CPU Copy For Every Dirty Cell
+				2.) lastUploadBytes Will Hold The Bytes Sent, Added To totalUploadBytes
+				3.) No Cell Will Be Dirty
+				4.) The LOD Pyramid (If Any) Will Be Current As Well
+				5.) Uploads Will Be Timed By The Frame Profiler
 
 		*/
 		void updateVertexBuffer()
 		{
 
-			glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
-			glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(Vertex) * (this->row_count * this->col_count * 4 + (this->row_count + 1 + this->col_count + 1) * 2), this->vertices);
-	
+			this->lastUploadBytes = 0;
+
+			if (this->dirtyCells.empty())
+			{
+				return;
+			}
+
+			FrameProfiler::CpuScope timer(FrameProfiler::CPU_UPLOAD);
+
+			if (this->renderer == CellRenderer::STATE_TEXTURE)
+			{
+				GLState::get().selectTexture(1, this->stateTexture);
+			}
+			else
+			{
+				GLState::get().bindArrayBuffer(this->renderer == CellRenderer::INSTANCED ? this->stateVBO : this->VBO);
+			}
+
+			size_t cellCount = static_cast<size_t>(this->row_count) * this->col_count;
+
+			if (this->dirtyCells.size() > cellCount * CONFIG::BOARD::FULL_UPLOAD_RATIO)
+			{
+				this->uploadCells(0, cellCount);
+			}
+			else
+			{
+				std::sort(this->dirtyCells.begin(), this->dirtyCells.end());
+
+				for (size_t i = 0; i < this->dirtyCells.size();)
+				{
+					unsigned int first = this->dirtyCells[i];
+					unsigned int last = first;
+
+					for (++i; i < this->dirtyCells.size() && this->dirtyCells[i] <= last + 1 + CONFIG::BOARD::DIRTY_MERGE_GAP; ++i)
+					{
+						last = this->dirtyCells[i];
+					}
+
+					this->uploadCells(first, last - first + 1);
+				}
+			}
+
+			for (unsigned int index : this->dirtyCells)
+			{
+				this->dirtyBits[index / 64] &= ~(1ULL << (index % 64));
+			}
+
+			this->dirtyCells.clear();
+
+			if (this->lodTexture != 0)
+			{
+				this->uploadLod();
+			}
+
+			this->totalUploadBytes += this->lastUploadBytes;
+
 		}
 
 
@@ -946,14 +1027,18 @@ class Board
 				3.) Board Must Not Already Be Initialized
 
 			Postconditions:
-				1.) All Vertex And Index Data Will Be Allocated And Populated
-				2.) OpenGL Buffers (VBO, EBO) Will Be Created And Loaded
-				3.) Vertex Attributes Will Be Configured For Rendering
-				4.) Board Game Logic Will Be Initialized With Mines Placed
-				5.) isInit Flag Will Be Set To true
+				1.) Per-Cell Vertex Data Will Be Allocated And Populated (Vertex Mode)
+				2.) VBO Will Hold One CellVertex Per Cell Behind cellTexture In Vertex
+				    Mode (With The Shared 16-Bit Index Pattern In EBO If Enabled);
+				    Otherwise stateVBO Or stateTexture Will Hold One Byte Per Cell
+				3.) packedVAO Will Be Created For Every Cell Mode And The Overview
+				    Quad, And lodTexture Unless LOD_CELL_PIXELS Is 0
+				4.) No VAO Will Be Left Bound
+				5.) Board Game Logic Will Be Initialized With Mines Placed From seed
+				6.) isInit Flag Will Be Set To true
 
 		*/
-		void initialize()
+		void initialize(uint64_t seed)
 		{
 
 			if (isInit)
@@ -962,34 +1047,78 @@ class Board
 				return;
 			}
 
-			// Calculate Grid Line Counts
-			unsigned int totalVertices = (this->row_count * this->col_count * 4) + ((this->row_count + 1) + (this->col_count + 1)) * 2;
-			unsigned int totalIndices = (this->row_count * this->col_count * 6) + ((this->row_count + 1) + (this->col_count + 1)) * 2;
+			this->engine.initialize(seed);
 
-			// Create Vertex Data With Enough Space For Grid Lines
-			this->vertices = new Vertex[totalVertices];
-			this->indices = new unsigned int[totalIndices];
+			// Per-Vertex Cells Are Fetched From A Buffer Texture And Numbered By gl_VertexID, Six Per Cell
+			size_t cellCount = static_cast<size_t>(this->row_count) * this->col_count;
+
+			if (this->renderer == CellRenderer::VERTICES)
+			{
+				GLint maxTexels = 0;
+				glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels);
+
+				if (cellCount > static_cast<size_t>(maxTexels) || cellCount > static_cast<size_t>(std::numeric_limits<GLsizei>::max() / 6))
+				{
+					std::cerr << "Board Is Too Large For Per-Vertex Cells, Using Instanced Cells...\n";
+					this->renderer = CellRenderer::INSTANCED;
+				}
+			}
+
+			if (this->renderer == CellRenderer::STATE_TEXTURE)
+			{
+				this->createStateTexture();
+			}
+
+			if (CONFIG::BOARD::LOD_CELL_PIXELS > 0.0f)
+			{
+				this->createLodTexture();
+			}
+
+			this->dirtyBits.assign((cellCount + 63) / 64, 0);
+
+			// Packed Cell Renderers Need No Per-Cell Vertices; The Grid Is Drawn By The Fragment Shader
+			if (this->renderer == CellRenderer::VERTICES)
+			{
+				this->vertices = new CellVertex[cellCount];
+				this->populateBoard();
+			}
 
-			this->populateBoard();
-			this->generateGridLines();
 			this->generateDigits();
-			this->loadBoard();
 
-			// Generate Buffers
-			glGenBuffers(1, &this->VBO);
-			glGenBuffers(1, &this->EBO);
+			GLState& gl = GLState::get();
 
-			// Bind Buffers
-			glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
-			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->EBO);
+			// Every Mode Takes Corners From gl_VertexID; Instanced Mode Also Streams One Byte Per Cell
+			glGenVertexArrays(1, &this->packedVAO);
+			gl.bindVertexArray(this->packedVAO);
+
+			if (this->renderer == CellRenderer::VERTICES)
+			{
+				glGenBuffers(1, &this->VBO);
+				gl.bindArrayBuffer(this->VBO);
+				glBufferData(GL_ARRAY_BUFFER, sizeof(CellVertex) * cellCount, this->vertices, GL_DYNAMIC_DRAW);
+
+				// Colour And Glyph Are Read As One RGBA8UI Texel Per Cell
+				glGenTextures(1, &this->cellTexture);
+				gl.bindTexture(3, this->cellTexture, GL_TEXTURE_BUFFER);
+				glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA8UI, this->VBO);
 
-			// Load Data Into Buffers With Correct Sizes
-			glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * totalVertices, this->vertices, GL_STATIC_DRAW);
-			glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(unsigned int) * totalIndices, this->indices, GL_STATIC_DRAW);
+				if (CONFIG::BOARD::SHARED_INDICES)
+				{
+					this->createSharedIndices();
+				}
+			}
+			else if (this->renderer == CellRenderer::INSTANCED)
+			{
+				glGenBuffers(1, &this->stateVBO);
+				gl.bindArrayBuffer(this->stateVBO);
+				glBufferData(GL_ARRAY_BUFFER, cellCount, this->engine.getCells(), GL_DYNAMIC_DRAW);
+
+				glVertexAttribIPointer(3, 1, GL_UNSIGNED_BYTE, 1, (void*)0);
+				glVertexAttribDivisor(3, 1);
+				glEnableVertexAttribArray(3);
+			}
 
-			// Set Vertex Attribute Pointers
-			glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
-			glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(sizeof(float) * 3));
+			gl.bindVertexArray(0);
 
 			this->isInit = true;
 
@@ -998,41 +1127,129 @@ class Board
 
 		/*
 	
-			Desc: Renders The Minesweeper Board Including All Cells And Grid Lines
-			Using OpenGL Draw Calls With Appropriate Vertex Attributes.
+			Desc: Renders The Visible Part Of The Minesweeper Board Through camera
+			From The Board's Own VAOs. Grid Lines Are Not Geometry: Every Cell
+			Mode Passes Cell-Space Coordinates To The Fragment Shader, Which
+			Blends In Anti-Aliased Lines One Pixel Wide And Fades Them Out Once
+			Cells Get Too Small To Separate. Once Cells Are Smaller Than
+			CONFIG::BOARD::LOD_CELL_PIXELS The Board Is Instead One Quad Shaded
+			From The LOD Pyramid, So Zoomed Out Frames Cost Per Pixel Rather
+			Than Per Cell. Binds Go Through GLState, And View
+			Uniforms And Culling Are Only Redone When The Camera Or Viewport
+			Changed, So A Steady Frame Only Issues Its Draws And The cellMode
+			Toggle.
 
 			Preconditions:
 				1.) Board Must Be Properly Initialized
 				2.) OpenGL Buffers Must Contain Current Vertex Data
-				3.) Shader Program Must Be Active
-				4.) Texture Atlas Must Be Bound To Texture Unit 0
+				3.) shader Must Be The Active Program
 
 			Postconditions:
-				1.) All Board Cells Will Be Rendered As Triangles
-				2.) Grid Lines Will Be Rendered As Lines
-				3.) Texture Atlas Will Be Available For Number/Flag Rendering
+				1.) Board Cells In View Will Be Rendered With The Grid Over Them;
+				    Vertex Mode Skips Cells Outside The View Entirely
+				2.) Texture Atlas Will Be Bound To Texture Unit 0 For Number/Flag Rendering
+				3.) The cellMode Uniform Will Be Restored To 0
 
 		*/
-		void render()
+		void render(const Shader& shader, const Camera& camera)
 		{
 
-			// Bind Our Buffers
-			glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
-			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->EBO);
+			GLState& gl = GLState::get();
+			gl.bindTexture(0, this->proceduralAtlasTextureID);
+			this->setBoardUniforms(shader);
 
-			glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
-			glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(sizeof(float) * 3));
-			glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(sizeof(float) * 6));
+			if (this->viewDirty || camera.getRevision() != this->cameraRevision)
+			{
+				this->updateView(shader, camera);
+				this->cameraRevision = camera.getRevision();
+				this->viewDirty = false;
+			}
 
-			glActiveTexture(GL_TEXTURE0);
-			glBindTexture(GL_TEXTURE_2D, this->proceduralAtlasTextureID);
+			// Zoomed Out Past Single Cells, Shade The Board From The Pyramid
+			if (this->useLod)
+			{
+				gl.call(glUniform1i, shader.getUniform("cellMode"), 4);
+				gl.bindVertexArray(this->packedVAO);
+				gl.bindTexture(2, this->lodTexture);
+				gl.call(glDrawArrays, GL_TRIANGLE_STRIP, 0, 4);
+			}
+			// Draw The Visible Cell Rectangle, Six Vertices Per Cell Or Four Through The Shared Indices
+			else if (this->renderer == CellRenderer::VERTICES)
+			{
+				gl.call(glUniform1i, shader.getUniform("cellMode"), 3);
+				gl.bindVertexArray(this->packedVAO);
+				gl.bindTexture(3, this->cellTexture, GL_TEXTURE_BUFFER);
 
-			// Draw The Board
-			glDrawElements(GL_TRIANGLES, this->row_count * this->col_count * 6, GL_UNSIGNED_INT, 0);
+				if (!this->drawCounts.empty())
+				{
+					gl.call(glMultiDrawElementsBaseVertex, GL_TRIANGLES, this->drawCounts.data(), GL_UNSIGNED_SHORT,
+						this->drawOffsets.data(), static_cast<GLsizei>(this->drawCounts.size()), this->drawBaseVertices.data());
+				}
+				else if (this->visibleCells > 0)
+				{
+					gl.call(glDrawArrays, GL_TRIANGLES, 0, static_cast<GLsizei>(this->visibleCells * 6));
+				}
+			}
+			else
+			{
+				this->renderPackedCells(shader);
+			}
 
-			// Draw The Grid Lines Based On Our linesOffset
-			glDrawElements(GL_LINES, (this->row_count + 1) * 2 + (this->col_count + 1) * 2, GL_UNSIGNED_INT, (void*)(sizeof(unsigned int) * this->row_count * this->col_count * 6));
+			gl.call(glUniform1i, shader.getUniform("cellMode"), 0);
 	
 		}
 
+
+		/*
+
+			Desc: Tells The Board The Framebuffer Size So The Board Outline Can
+			Keep Its One Pixel Margin For The Outer Grid Lines.
+
+			Preconditions:
+				1.) width And height Must Be The Current Viewport Size
+
+			Postconditions:
+				1.) View Uniforms Will Be Re-Sent On The Next Render
+
+		*/
+		void setViewport(unsigned int width, unsigned int height)
+		{
+
+			this->viewportWidth = width;
+			this->viewportHeight = height;
+			this->viewDirty = true;
+
+		}
+
+
+		/*
+
+			Desc: Upload Counters. getLastUploadBytes Reports The Cell Bytes
+			Sent By The Most Recent Event, getTotalUploadBytes The Running Sum.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Requested Counter
+
+		*/
+		unsigned long long getLastUploadBytes() const { return this->lastUploadBytes; }
+		unsigned long long getTotalUploadBytes() const { return this->totalUploadBytes; }
+
+
+		/*
+
+			Desc: Number Of Cells Covered By The Last Culled Draw. In Instanced
+			Mode It Is Rounded Out To Whole Rows.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Visible Cell Count
+
+		*/
+		size_t getVisibleCells() const { return this->visibleCells; }
+
 };
\ No newline at end of file
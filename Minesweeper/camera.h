@@ -0,0 +1,217 @@
+#pragma once
+
+
+
+#include <algorithm>
+#include <glm/common.hpp>
+#include <glm/mat4x4.hpp>
+#include <glm/matrix.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec4.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include "config.h"
+
+
+class Camera
+{
+
+	private:
+
+		// ~~~~~~ View (World Space Is The Board Layout In CONFIG::BOARD) ~~~~~~
+		glm::vec2 center = glm::vec2(0.0f);
+		float zoom = 1.0f;
+
+
+		// ~~~~~~ Area The Camera May Look At ~~~~~~
+		glm::vec2 boundsMin = glm::vec2(-1.0f);
+		glm::vec2 boundsMax = glm::vec2(1.0f);
+
+
+		// ~~~~~~ Cached Transforms ~~~~~~
+		glm::mat4 viewProjection = glm::mat4(1.0f);
+		glm::mat4 inverseViewProjection = glm::mat4(1.0f);
+		unsigned long long revision = 0;
+
+
+		/*
+
+			Desc: Rebuilds The View-Projection Matrix And Its Inverse After The
+			Center Or Zoom Changed. The View Is An Orthographic Box 2 / zoom
+			World Units Across, So zoom 1 Centered At The Origin Is The Identity
+			And Reproduces The Fixed Layout The Board Used Before.
+
+			Preconditions:
+				1.) zoom Must Be Positive
+
+			Postconditions:
+				1.) viewProjection And inverseViewProjection Will Match center And zoom
+				2.) revision Will Be Incremented
+
+		*/
+		void update()
+		{
+
+			float halfExtent = 1.0f / this->zoom;
+
+			this->viewProjection = glm::ortho(this->center.x - halfExtent, this->center.x + halfExtent,
+				this->center.y - halfExtent, this->center.y + halfExtent);
+			this->inverseViewProjection = glm::inverse(this->viewProjection);
+			++this->revision;
+
+		}
+
+
+		/*
+
+			Desc: Keeps The View Center Inside The Bounds So The Board Can Not
+			Be Panned Out Of Sight.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) center Will Lie Within [boundsMin, boundsMax]
+
+		*/
+		void clampCenter()
+		{
+
+			this->center = glm::clamp(this->center, this->boundsMin, this->boundsMax);
+
+		}
+
+
+
+	public:
+
+		/*
+
+			Desc: Constructs A Camera Showing The Whole Default Layout, Limited
+			To Looking At The Given World Rectangle.
+
+			Preconditions:
+				1.) boundsMin Must Not Exceed boundsMax
+
+			Postconditions:
+				1.) The Camera Will Show World [-1, 1] On Both Axes
+
+		*/
+		Camera(const glm::vec2& boundsMin = glm::vec2(CONFIG::BOARD::X_OFFSET, CONFIG::BOARD::Y_OFFSET),
+			const glm::vec2& boundsMax = glm::vec2(CONFIG::BOARD::X_OFFSET + CONFIG::BOARD::WIDTH, CONFIG::BOARD::Y_OFFSET + CONFIG::BOARD::HEIGHT)) :
+			boundsMin(boundsMin), boundsMax(boundsMax)
+		{
+
+			this->update();
+
+		}
+
+
+		/*
+
+			Desc: Zooms By factor About A Point Given In Normalized Device
+			Coordinates, Keeping The World Point Under It Fixed (Zoom To Cursor).
+
+			Preconditions:
+				1.) factor Must Be Positive
+
+			Postconditions:
+				1.) zoom Will Be Scaled By factor, Clamped To CONFIG::CAMERA
+				2.) Returns true If The View Changed
+
+		*/
+		bool zoomAt(const glm::vec2& ndc, float factor)
+		{
+
+			float newZoom = std::min(std::max(this->zoom * factor, CONFIG::CAMERA::MIN_ZOOM), CONFIG::CAMERA::MAX_ZOOM);
+
+			if (newZoom == this->zoom)
+			{
+				return false;
+			}
+
+			glm::vec2 anchor = this->ndcToWorld(ndc);
+
+			this->zoom = newZoom;
+			this->center = anchor - ndc / newZoom;
+			this->clampCenter();
+			this->update();
+
+			return true;
+
+		}
+
+
+		/*
+
+			Desc: Moves The View By A Drag Of ndcDelta, So The Content Follows
+			The Cursor.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) center Will Have Moved By -ndcDelta / zoom, Then Been Clamped
+				2.) Returns true If The View Changed
+
+		*/
+		bool pan(const glm::vec2& ndcDelta)
+		{
+
+			glm::vec2 previous = this->center;
+
+			this->center -= ndcDelta / this->zoom;
+			this->clampCenter();
+
+			if (this->center == previous)
+			{
+				return false;
+			}
+
+			this->update();
+
+			return true;
+
+		}
+
+
+		/*
+
+			Desc: Maps A Point In Normalized Device Coordinates Back To World
+			Space Through The Inverse View-Projection, For Picking.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The World Position Drawn At ndc
+
+		*/
+		glm::vec2 ndcToWorld(const glm::vec2& ndc) const
+		{
+
+			glm::vec4 world = this->inverseViewProjection * glm::vec4(ndc, 0.0f, 1.0f);
+			return glm::vec2(world) / world.w;
+
+		}
+
+
+		/*
+
+			Desc: Camera Accessors. getVisibleMin/Max Are The World Rectangle
+			On Screen; getRevision Changes Whenever The View Does, So Consumers
+			Can Tell When Cached Uniforms Or Culling Results Are Stale.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Requested Value
+
+		*/
+		const glm::mat4& getViewProjection() const { return this->viewProjection; }
+		glm::vec2 getVisibleMin() const { return this->ndcToWorld(glm::vec2(-1.0f)); }
+		glm::vec2 getVisibleMax() const { return this->ndcToWorld(glm::vec2(1.0f)); }
+		float getZoom() const { return this->zoom; }
+		unsigned long long getRevision() const { return this->revision; }
+
+};
\ No newline at end of file
@@ -9,6 +9,8 @@ namespace CONFIG
 		constexpr unsigned int WIDTH = 1400;
 		constexpr unsigned int HEIGHT = 1400;
 		constexpr const char* TITLE = "Minesweeper";
+		constexpr bool EVENT_DRIVEN = true;			// Sleep In glfwWaitEvents And Redraw Only When Something Changed
+		constexpr double MAX_FPS = 0.0;				// Redraw Rate Cap (0 = Uncapped)
 	};
 
 
@@ -21,6 +23,44 @@ namespace CONFIG
 		constexpr unsigned int ROW_COUNT = 35;
 		constexpr unsigned int COL_COUNT = 35;
 		constexpr unsigned int MINE_COUNT = 178;
+		constexpr bool PRECOMPUTE_OPENINGS = false;	// Label Every Zero Region At Generation (Costs A Serial Union-Find Pass Per Board)
+		enum class CellRenderer { VERTICES, INSTANCED, STATE_TEXTURE };
+		constexpr CellRenderer CELL_RENDERER = CellRenderer::STATE_TEXTURE;	// Per-Cell Vertices, Instanced Quads, Or One Quad Over A Cell State Texture
+		constexpr float FULL_UPLOAD_RATIO = 0.25f;	// Dirty Cell Share Above Which The Whole VBO Is Re-Sent
+		constexpr unsigned int DIRTY_MERGE_GAP = 4;	// Clean Cells Allowed Inside One Upload Range
+		constexpr bool SHARED_INDICES = false;		// Vertex Mode: Draw Through One Shared 16-Bit Index Pattern (4 Vertex Shader Runs Per Cell, Not 6)
+		constexpr float LOD_CELL_PIXELS = 1.0f;		// Cells Smaller Than This On Screen Are Drawn From The LOD Pyramid (0 = Never)
+		constexpr unsigned int LOD_MAX_SIZE = 2048;	// Largest LOD Pyramid Level In Texels Per Side
+	};
+
+
+	namespace CAMERA
+	{
+		constexpr float MIN_ZOOM = 0.5f;
+		constexpr float MAX_ZOOM = 4096.0f;			// Enough For Readable Cells On 10^7+ Cell Boards
+		constexpr float ZOOM_STEP = 1.2f;			// Zoom Factor Per Mouse Wheel Notch
+	};
+
+
+	namespace PROFILER
+	{
+		constexpr bool ENABLED = true;				// GPU Timer Queries And CPU Timers Feeding Rolling Percentiles
+		constexpr unsigned int SAMPLE_WINDOW = 240;	// Most Recent Samples Per Timer The Percentiles Cover
+		constexpr bool SHOW_OVERLAY = false;		// Start With The Timing Overlay Shown (F3 Toggles It)
+		constexpr const char* EXPORT_PATH = "./frametimes.csv";	// Written Only When F4 Is Pressed ("" = Never)
+	};
+
+
+	namespace INPUT
+	{
+		constexpr const char* SCRIPT_PATH = "";		// Clicks Replayed Into The Window Once The Main Loop Starts ("" = None)
+		constexpr bool MEASURE_LATENCY = false;		// Time Interactive Clicks Through Update, Upload And A Fence Behind The Frame Showing Them (Scripts Always Are)
+	};
+
+
+	namespace OFFSCREEN
+	{
+		constexpr unsigned int READBACK_SLOTS = 3;	// Frames In Flight Between glReadPixels And PNG Encoding
 	};
 
 
@@ -28,6 +68,8 @@ namespace CONFIG
 	{
 		constexpr const char* VERTEX_PATH = "./default.vert";
 		constexpr const char* FRAGMENT_PATH = "./default.frag";
+		constexpr bool CACHE_PROGRAMS = true;		// Reuse Linked Program Binaries Across Launches (NAME.shadercache Beside The Shaders)
+		constexpr bool EMBED_SOURCES = false;		// Build The Shader Files Into The Executable (shadersources.h, Generated By embedshaders.py) Instead Of Reading Them
 
 
 		namespace TEXT_ATLAS
@@ -39,6 +81,8 @@ namespace CONFIG
 			constexpr unsigned int NUM_DIGITS = 10;     // 0-9
             constexpr unsigned int FLAG_INDEX = 10;
 			constexpr unsigned int TOTAL_CHARS = 11;
+			constexpr bool DISTANCE_FIELD = false;		// Store Glyphs As Signed Distances, Filtered Linearly So Edges Stay Smooth When Zoomed In
+			constexpr unsigned int DISTANCE_SPREAD = 3;	// Texels Over Which The Distance Field Ramps
 		};
 
 
@@ -52,6 +96,10 @@ namespace CONFIG
 			constexpr float MINE_BASE_COLOR_G = 0.6f;
 			constexpr float MINE_BASE_COLOR_B = 0.6f;
 
+			constexpr float GRID_COLOR_R = 0.1f;
+			constexpr float GRID_COLOR_G = 0.1f;
+			constexpr float GRID_COLOR_B = 0.1f;
+
 		};
 
 	};
@@ -3,13 +3,119 @@
 out vec4 FragColor;
 
 in vec3 vertColor;
-in vec2 texCoord; // Add this line
+in vec2 texCoord;
+in vec2 boardCoord;
+flat in uint cellValue;
 
 uniform sampler2D numberAtlas;
 uniform int useTexture;
 
+uniform int cellMode;			// 0 = Passthrough, 1 = Instanced Cells, 2 = State Texture Quad, 3 = Per-Vertex Cells, 4 = LOD Overview Quad, 5 = Overlay Glyphs
+uniform usampler2D boardState;	// One Packed Engine Cell Per Texel, Row-Major, stateWidth Texels Per Row
+uniform uint stateWidth;
+uniform uvec2 boardDims;		// Columns, Rows
+uniform vec3 hiddenColor;
+uniform vec3 gridColor;
+uniform float atlasSlot;
+uniform float flagGlyph;
+uniform sampler2D lodPyramid;	// Mipmapped Cell State Shares: R Revealed, G Flagged, B Exploded, A Coverage
+uniform float lodBase;			// log2 Of The Cells Per Side Of One Level 0 Texel
+uniform vec2 lodScale;			// Cells To Level 0 Texture Coordinates
+
+// Shades One Cell From Its Packed Byte (Bits 0-3 Count, Bits 4-5 State, Bit 6 Mine) And
+// The Fragment's Position Within The Cell
+vec4 shadeCell(uint cell, vec2 uv)
+{
+    uint count = cell & 15u;
+    uint state = (cell >> 4) & 3u;
+    bool mine = (cell & 64u) != 0u;
+
+    if (state == 0u) return vec4(hiddenColor, 1.0);
+    if (mine) return vec4(1.0, 0.0, 0.0, 1.0);
+
+    vec3 color = vec3(1.0);
+    float glyph = -1.0;
+
+    if (state == 2u) {
+        color = vec3(1.0, 1.0, 0.0);
+        glyph = flagGlyph;
+    } else if (count > 0u) {
+        color = vec3(0.9);
+        glyph = float(count);
+    }
+
+    // Glyphs Span Their Atlas Slot, Flipped Vertically
+    if (glyph >= 0.0 && textureLod(numberAtlas, vec2(glyph * atlasSlot + uv.x * atlasSlot, 1.0 - uv.y), 0.0).r > 0.5) {
+        color *= 0.3;
+    }
+
+    return vec4(color, 1.0);
+}
+
+// Shades A Pixel Covering Many Cells From The Pyramid Level Whose Texels Match The
+// Pixel's Footprint, Blending The Cell Colours By How Much Of The Footprint Each Covers
+vec4 shadeOverview()
+{
+    vec2 perPixel = fwidth(boardCoord);
+    vec4 share = textureLod(lodPyramid, boardCoord * lodScale, log2(max(perPixel.x, perPixel.y)) - lodBase);
+
+    if (share.a <= 0.0) return vec4(hiddenColor, 1.0);
+
+    vec3 color = hiddenColor * max(share.a - share.r - share.g - share.b, 0.0) +
+        vec3(0.95) * share.r + vec3(1.0, 1.0, 0.0) * share.g + vec3(1.0, 0.0, 0.0) * share.b;
+
+    return vec4(color / share.a, 1.0);
+}
+
+// Anti-Aliased Grid Coverage. Each Line Is One Pixel Wide And Sits Just Below/Left Of
+// Its Cell Edge, Matching Where GL_LINES Put It, So Pixel-Aligned Edges Stay Crisp. The
+// Grid Fades Out As Cells Shrink From Six To Three Pixels Instead Of Aliasing.
+float gridCoverage()
+{
+    vec2 perPixel = fwidth(boardCoord);
+    vec2 offset = (boardCoord - floor(boardCoord + 0.5)) / perPixel + 0.5;
+    vec2 coverage = clamp(1.0 - abs(offset), 0.0, 1.0);
+
+    return max(coverage.x, coverage.y) * (1.0 - smoothstep(1.0 / 6.0, 1.0 / 3.0, max(perPixel.x, perPixel.y)));
+}
+
 void main()
 {
+    // Overlay Tiles Are Solid, Glyphs Keep Only Their Strokes
+    if (cellMode == 5) {
+        if (texCoord.x >= 0.0 && texture(numberAtlas, texCoord).r <= 0.5) discard;
+        FragColor = vec4(vertColor, 1.0);
+        return;
+    }
+
+    if (cellMode != 0) {
+        float grid = gridCoverage();
+
+        // Vertices On The Outline Overhang The Board By A Pixel For The Outer Lines
+        if (any(lessThan(boardCoord, vec2(0.0))) || any(greaterThanEqual(boardCoord, vec2(boardDims)))) {
+            if (grid < 0.5) discard;
+            FragColor = vec4(gridColor, 1.0);
+            return;
+        }
+
+        vec4 cellColor;
+
+        if (cellMode == 1) {
+            cellColor = shadeCell(cellValue, fract(boardCoord));
+        } else if (cellMode == 2) {
+            uvec2 cell = min(uvec2(boardCoord), boardDims - 1u);
+            uint index = cell.y * boardDims.x + cell.x;
+            cellColor = shadeCell(texelFetch(boardState, ivec2(index % stateWidth, index / stateWidth), 0).r, fract(boardCoord));
+        } else if (cellMode == 4) {
+            cellColor = shadeOverview();
+        } else {
+            cellColor = vec4(texture(numberAtlas, texCoord).r > 0.5 ? vertColor * 0.3 : vertColor, 1.0);
+        }
+
+        FragColor = vec4(mix(cellColor.rgb, gridColor, grid), 1.0);
+        return;
+    }
+
     if (useTexture == 1) {
         float atlasValue = texture(numberAtlas, texCoord).r;
         if (atlasValue > 0.5) {
@@ -2,19 +2,101 @@
 
 
 
-layout (location = 0) in vec3 aPos;
+layout (location = 0) in vec2 aPos;		// Unit Corner (Background), Glyph Cell Corner On The Screen (Overlay)
 layout (location = 1) in vec3 aColor;
-layout (location = 2) in vec2 aTexCoord;
+layout (location = 2) in uint aGlyph;		// Atlas Slot, 255 For A Solid Tile (Overlay Only)
+layout (location = 3) in uint aCell;		// Packed Engine Cell (Instanced Mode Only)
 
 out vec3 vertColor;
 out vec2 texCoord;
+out vec2 boardCoord;			// Position On The Board In Cells (Cell Modes Only)
+flat out uint cellValue;		// Packed Engine Cell (Instanced Mode Only)
+
+uniform int cellMode;			// 0 = Passthrough, 1 = Instanced Cells, 2 = State Texture Quad, 3 = Per-Vertex Cells, 4 = LOD Overview Quad, 5 = Overlay Glyphs
+uniform mat4 viewProjection;	// Camera, Applied To The Board Only
+uniform vec2 boardOrigin;
+uniform vec2 cellSize;
+uniform uvec2 boardDims;		// Columns, Rows
+uniform vec2 gridMargin;		// One Pixel In Cells
+uniform float atlasSlot;		// Atlas Width Of One Glyph
+uniform uint instanceBase;		// First Cell Of The Visible Row Band (Instanced Mode Only)
+uniform usamplerBuffer cellRecords;	// Colour And Glyph Per Cell, Row-Major (Per-Vertex Mode Only)
+uniform uvec2 viewOrigin;		// First Visible Column And Row (Per-Vertex Mode Only)
+uniform uint viewColumns;		// Visible Columns (Per-Vertex Mode Only)
+uniform uint cellVertices;		// 6 Drawing Arrays, 4 Through The Shared Index Pattern (Per-Vertex Mode Only)
+uniform vec2 glyphSize;			// One Glyph Cell In Unit Screen Coordinates (Overlay Only)
+
+// Quad Corner Of Each Vertex Of A Cell's Two Triangles When Drawn Without Indices
+const uint triangleCorners[6] = uint[6](0u, 1u, 3u, 1u, 2u, 3u);
+
+
+// Offset Pushing Vertices On The Board's Outline Out By gridMargin So The Outer Grid Lines Are Covered
+vec2 outlineOffset(vec2 coord)
+{
+
+	return gridMargin * (step(vec2(boardDims) - 0.5, coord) - step(coord, vec2(0.5)));
+
+}
 
 
 void main()
 {
 
-	gl_Position = vec4(aPos, 1.0);
 	vertColor = aColor;
-	texCoord = aTexCoord;
+	texCoord = vec2(0.0);
+	cellValue = 0u;
+
+	if (cellMode == 0)
+	{
+		gl_Position = vec4(aPos * 2.0 - 1.0, 0.0, 1.0);
+		return;
+	}
+
+	// Unit Quad Corner From The Strip Vertex (0 = Bottom Left ... 3 = Top Right)
+	vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));
+
+	if (cellMode == 5)
+	{
+		// One Instance Per Glyph Cell With aPos Its Bottom Left Corner On The Screen; Solid
+		// Tiles Get A Negative texCoord, Glyphs Span Their Atlas Slot Flipped Vertically
+		gl_Position = vec4((aPos + corner * glyphSize) * 2.0 - 1.0, 0.0, 1.0);
+		texCoord = aGlyph == 255u ? vec2(-1.0) : vec2((float(aGlyph) + corner.x) * atlasSlot, 1.0 - corner.y);
+		return;
+	}
+
+	if (cellMode == 3)
+	{
+		// Vertex IDs Number The Visible Rectangle Cell By Cell, Whose Four Corners Run Top Right,
+		// Bottom Right, Bottom Left, Top Left. Glyph UVs Span One Atlas Slot Across And Run Top
+		// To Bottom Down The Cell, Extended With The Outline To Keep The Glyph In Place
+		uint id = uint(gl_VertexID);
+		uint visible = id / cellVertices;
+		uint vertex = cellVertices == 4u ? id & 3u : triangleCorners[id % 6u];
+		uvec2 cell = viewOrigin + uvec2(visible % viewColumns, visible / viewColumns);
+		vec2 cellCorner = vec2(vertex < 2u ? 1.0 : 0.0, (vertex == 0u || vertex == 3u) ? 1.0 : 0.0);
+		uvec4 record = texelFetch(cellRecords, int(cell.y * boardDims.x + cell.x));
+
+		vertColor = vec3(record.rgb) / 255.0;
+		boardCoord = vec2(cell) + cellCorner;
+		vec2 offset = outlineOffset(boardCoord);
+
+		if (record.a != 255u)
+		{
+			texCoord = vec2((float(record.a) + cellCorner.x + offset.x) * atlasSlot, 1.0 - cellCorner.y - offset.y);
+		}
+	}
+	else if (cellMode == 1)
+	{
+		uint cell = instanceBase + uint(gl_InstanceID);
+		boardCoord = vec2(float(cell % boardDims.x), float(cell / boardDims.x)) + corner;
+		cellValue = aCell;
+	}
+	else
+	{
+		boardCoord = corner * vec2(boardDims);
+	}
+
+	boardCoord += outlineOffset(boardCoord);
+	gl_Position = viewProjection * vec4(boardOrigin + boardCoord * cellSize, 0.0, 1.0);
 
 }
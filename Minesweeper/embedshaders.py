@@ -0,0 +1,69 @@
+# Generates shadersources.h From default.vert And default.frag, So The Shaders
+# Embedded When CONFIG::SHADER::EMBED_SOURCES Is Set Are Always The Files On Disk.
+# The Minesweeper Project Runs This Before Compiling Whenever A Shader Changes;
+# Other Builds Run It By Hand After Editing A Shader:
+#
+#     python embedshaders.py
+
+import os
+import sys
+
+
+DIRECTORY = os.path.dirname(os.path.abspath(__file__))
+OUTPUT = os.path.join(DIRECTORY, "shadersources.h")
+SHADERS = (("vertex", "default.vert"), ("fragment", "default.frag"))
+
+DELIMITER = "GLSL"
+CHUNK_LIMIT = 16000	# MSVC Rejects Single String Literals Over 16380 Bytes (C2026)
+
+
+def literal(source, path):
+
+	if ")" + DELIMITER + "\"" in source:
+		sys.exit(path + " Contains The Raw String Terminator )" + DELIMITER + "\"")
+
+	# Split At Line Ends Into Adjacent Literals, Which The Compiler Concatenates
+	chunks, current = [], ""
+
+	for line in source.splitlines(True):
+		if current and len(current) + len(line) > CHUNK_LIMIT:
+			chunks.append(current)
+			current = ""
+		current += line
+
+	chunks.append(current)
+
+	return "\n".join("R\"" + DELIMITER + "(" + chunk + ")" + DELIMITER + "\"" for chunk in chunks)
+
+
+def main():
+
+	functions = []
+
+	for name, path in SHADERS:
+		with open(os.path.join(DIRECTORY, path), "r", newline="") as file:
+			source = file.read().replace("\r\n", "\n")
+
+		functions.append(
+			"\t\tstatic const char* " + name + "()\n"
+			"\t\t{\n\n"
+			"\t\t\treturn " + literal(source, path) + ";\n\n"
+			"\t\t}\n")
+
+	header = (
+		"#pragma once\n\n\n\n"
+		"// Generated By embedshaders.py From default.vert And default.frag; Do Not Edit.\n"
+		"// Compiled Into The Executable When CONFIG::SHADER::EMBED_SOURCES Is Set So\n"
+		"// Startup Reads No Files.\n"
+		"class ShaderSources\n"
+		"{\n\n"
+		"\tpublic:\n\n" +
+		"\n\n".join(functions) +
+		"\n};")
+
+	with open(OUTPUT, "w", newline="\n") as file:
+		file.write(header)
+
+
+if __name__ == "__main__":
+	main()
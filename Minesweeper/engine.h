@@ -0,0 +1,690 @@
+#pragma once
+
+
+
+#include "config.h"
+#include "generator.h"
+#include "openings.h"
+#include <cstdint>
+#include <vector>
+
+
+class Engine
+{
+
+	public:
+
+		// ~~~~~~ Cell State ~~~~~~
+		enum class CellState { HIDDEN, REVEALED, FLAGGED };
+
+
+		// ~~~~~~ Game State ~~~~~~
+		enum class GameState { PLAYING, WON, LOST };
+
+
+	private:
+
+		// ~~~~~~ Initialization State ~~~~~~
+		bool isInit = false;
+
+
+		// ~~~~~~ Packed Cell Layout (One Byte Per Cell) ~~~~~~
+		//   Bits 0-3 : Adjacent Mine Count (0-8)
+		//   Bits 4-5 : CellState
+		//   Bit  6   : Mine Flag
+		static constexpr unsigned char COUNT_MASK = 0x0F;
+		static constexpr unsigned char STATE_SHIFT = 4;
+		static constexpr unsigned char STATE_MASK = 0x30;
+		static constexpr unsigned char MINE_BIT = 0x40;
+
+
+		// ~~~~~~ Board Data ~~~~~~
+		unsigned char* cells = nullptr;
+		unsigned int row_count, col_count;
+		unsigned int mineCount;
+
+
+		// ~~~~~~ Mine Placement ~~~~~~
+		uint64_t seed = 0;
+		std::vector<unsigned int> mineIndices;
+
+
+		// ~~~~~~ Precomputed Openings (Optional) ~~~~~~
+		OpeningIndex openings;
+		bool precomputeOpenings = CONFIG::BOARD::PRECOMPUTE_OPENINGS;
+
+
+		// ~~~~~~ Flood Fill (Reused Span Stack) ~~~~~~
+		struct Span { unsigned int row, left, right; };
+		std::vector<Span> spans;
+
+
+		// ~~~~~~ Change Tracking ~~~~~~
+		std::vector<unsigned int> changedCells;
+
+
+		// ~~~~~~ Live Counters (Kept In Step With Every State Change) ~~~~~~
+		unsigned int revealedSafe = 0;
+		unsigned int flagCount = 0;
+		GameState gameState = GameState::PLAYING;
+
+
+		/*
+
+			Desc: Allocates The Cell Grid For The Board As A Single Contiguous
+			Row-Major Buffer. The Bytes Are Left Uninitialized; The Generator
+			Zeroes Each Tile On The Thread That Fills It.
+
+			Preconditions:
+				1.) row_count And col_count Must Be Valid Board Dimensions
+
+			Postconditions:
+				1.) cells Will Hold row_count * col_count Bytes
+
+		*/
+		void populateBoard()
+		{
+
+			this->cells = new unsigned char[static_cast<size_t>(this->row_count) * this->col_count];
+
+		}
+
+
+		/*
+
+			Desc: Helpers For Reading And Writing The Packed Cell Encoding.
+
+			Preconditions:
+				1.) index Must Be A Valid Linear Cell Index
+
+			Postconditions:
+				1.) Accessors Return The Decoded Field
+				2.) setState Only Touches The State Bits Of The Cell, Keeping
+				    revealedSafe And flagCount In Step
+
+		*/
+		unsigned int cellIndex(unsigned int row, unsigned int col) const
+		{
+
+			return row * this->col_count + col;
+
+		}
+
+		CellState stateAt(unsigned int index) const
+		{
+
+			return static_cast<CellState>((this->cells[index] & STATE_MASK) >> STATE_SHIFT);
+
+		}
+
+		void setState(unsigned int index, CellState state)
+		{
+
+			CellState previous = this->stateAt(index);
+
+			if (previous == CellState::FLAGGED) --this->flagCount;
+			if (state == CellState::FLAGGED) ++this->flagCount;
+
+			if (!this->mineAt(index))
+			{
+				if (previous == CellState::REVEALED) --this->revealedSafe;
+				if (state == CellState::REVEALED) ++this->revealedSafe;
+			}
+
+			this->cells[index] = static_cast<unsigned char>((this->cells[index] & ~STATE_MASK) | (static_cast<unsigned char>(state) << STATE_SHIFT));
+
+		}
+
+		unsigned int countAt(unsigned int index) const
+		{
+
+			return this->cells[index] & COUNT_MASK;
+
+		}
+
+		bool mineAt(unsigned int index) const
+		{
+
+			return (this->cells[index] & MINE_BIT) != 0;
+
+		}
+
+
+		/*
+
+			Desc: Clears The Counters Ahead Of A New Game. The Cells Themselves
+			Are Rewritten In Full By loadBoard(), Which Zeroes Every Tile In
+			Parallel Before Placing Its Mines.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Counters Will Be Zero And gameState PLAYING
+
+		*/
+		void resetBoard()
+		{
+
+			this->revealedSafe = 0;
+			this->flagCount = 0;
+			this->gameState = GameState::PLAYING;
+
+		}
+
+
+		/*
+
+			Desc: Places Exactly mineCount Mines Chosen From seed And Calculates
+			Adjacent Mine Counts For All Cells. TiledGenerator Splits The Board
+			Into Row-Band Tiles Across All Cores; Each Tile Places Its Share Of
+			Mines With MinePlacer And Counts Its Band With AdjacencyKernel.
+
+			Preconditions:
+				1.) cells Array Must Be Properly Allocated
+				2.) row_count, col_count, And mineCount Must Be Valid
+
+			Postconditions:
+				1.) mineIndices Will Hold The Linear Index Of Every Mine
+				2.) Each Cell Will Have Correct Adjacent Count And Mine Bit
+				3.) The Same seed Will Always Produce The Same Board
+				4.) openings Will Be Rebuilt If precomputeOpenings Is Set, Else Released
+
+		*/
+		void loadBoard()
+		{
+
+			unsigned int cellCount = this->row_count * this->col_count;
+
+			if (this->mineCount > cellCount)
+			{
+				this->mineCount = cellCount;
+			}
+
+			TiledGenerator::generate(this->seed, this->cells, this->row_count, this->col_count,
+				this->mineCount, MINE_BIT, this->mineIndices);
+
+			if (this->precomputeOpenings)
+			{
+				this->openings.build(this->cells, this->row_count, this->col_count, COUNT_MASK, MINE_BIT);
+			}
+			else
+			{
+				this->openings.clear();
+			}
+
+		}
+
+
+		/*
+
+			Desc: Reveals The Hidden Zero Run Through (row, col) And Its Two
+			Numbered End Cells, And Queues The Run So Its Neighbouring Rows Get
+			Scanned. The Whole Run Is Revealed In One Pass Over The Row.
+
+			Preconditions:
+				1.) (row, col) Must Be A Hidden Zero Cell
+
+			Postconditions:
+				1.) The Run [left, right] And Its Hidden End Cells Will Be Revealed
+				2.) The Run Will Be Pushed Onto spans
+				3.) Returns right, The Last Column Of The Run
+
+		*/
+		unsigned int openRun(unsigned int row, unsigned int col)
+		{
+
+			unsigned char* line = this->cells + static_cast<size_t>(row) * this->col_count;
+			unsigned int base = row * this->col_count;
+			unsigned int left = col, right = col;
+
+			// A Zero Byte Is A Hidden, Mine-Free Cell With No Adjacent Mines
+			while (left > 0 && line[left - 1] == 0) --left;
+			while (right + 1 < this->col_count && line[right + 1] == 0) ++right;
+
+			const unsigned char revealed = static_cast<unsigned char>(CellState::REVEALED) << STATE_SHIFT;
+
+			for (unsigned int c = left; c <= right; ++c)
+			{
+				line[c] |= revealed;
+				this->changedCells.push_back(base + c);
+			}
+
+			this->revealedSafe += right - left + 1;
+
+			if (left > 0) this->revealBorder(base + left - 1);
+			if (right + 1 < this->col_count) this->revealBorder(base + right + 1);
+
+			this->spans.push_back({ row, left, right });
+
+			return right;
+
+		}
+
+
+		/*
+
+			Desc: Reveals A Numbered Cell On The Edge Of An Opening Unless It
+			Is Already Revealed Or Flagged. Cells Next To A Zero Cell Are Never
+			Mines, So No Mine Check Is Needed.
+
+			Preconditions:
+				1.) index Must Neighbour A Zero Cell
+
+			Postconditions:
+				1.) A Hidden Cell Will Be Revealed And Recorded In changedCells
+
+		*/
+		void revealBorder(unsigned int index)
+		{
+
+			if (this->stateAt(index) == CellState::HIDDEN)
+			{
+				this->setState(index, CellState::REVEALED);
+				this->changedCells.push_back(index);
+			}
+
+		}
+
+
+		/*
+
+			Desc: Reveals A Whole Opening In One Pass Over Its Precomputed Cell
+			List, Which Gives The Same Result As bloomOut() From Any Of Its Zero
+			Cells As Long As None Of Them Has Been Flagged This Game.
+
+			Preconditions:
+				1.) openings Must Be Built
+				2.) region Must Not Be Marked As Flagged
+
+			Postconditions:
+				1.) Every Hidden Cell Of The Opening Will Be Revealed
+				2.) Every Revealed Cell Will Be Recorded In changedCells
+
+		*/
+		void revealOpening(unsigned int region)
+		{
+
+			const unsigned int* first = this->openings.regionBegin(region);
+			const unsigned int* last = this->openings.regionEnd(region);
+			const unsigned char revealed = static_cast<unsigned char>(CellState::REVEALED) << STATE_SHIFT;
+
+			for (const unsigned int* it = first; it != last; ++it)
+			{
+				if ((this->cells[*it] & STATE_MASK) == 0)
+				{
+					this->cells[*it] |= revealed;
+					this->changedCells.push_back(*it);
+					++this->revealedSafe;
+				}
+			}
+
+		}
+
+
+		/*
+
+			Desc: Implements A Scanline Flood Fill To Automatically Reveal The
+			Opening Around A Cell With No Adjacent Mines. Whole Horizontal Runs
+			Of Zero Cells Are Revealed At Once And Queued As Spans; Each Span
+			Then Scans Only The Columns [left - 1, right + 1] Of The Rows Above
+			And Below, Opening Any Zero Runs It Meets And Revealing The Numbered
+			Cells That Border The Opening. Revealed Cells Stop Being Zero Bytes,
+			So The State Bits Double As The Visited Mark.
+
+			Preconditions:
+				1.) row And col Must Be Valid Cell Coordinates Of A Hidden Zero Cell
+				2.) cells Array Must Be Properly Initialized
+
+			Postconditions:
+				1.) All Connected Empty Cells Will Be Revealed
+				2.) Cells With Adjacent Mines Will Be Revealed But Not Expanded
+				3.) Flagged Cells Will Be Left Flagged
+				4.) Every Revealed Cell Will Be Recorded In changedCells
+
+		*/
+		void bloomOut(unsigned int row, unsigned int col)
+		{
+
+			this->spans.clear();
+			this->openRun(row, col);
+
+			while (!this->spans.empty())
+			{
+				Span span = this->spans.back();
+				this->spans.pop_back();
+
+				unsigned int first = span.left > 0 ? span.left - 1 : 0;
+				unsigned int last = span.right + 1 < this->col_count ? span.right + 1 : span.right;
+
+				for (int dr = -1; dr <= 1; dr += 2)
+				{
+					if ((dr < 0 && span.row == 0) || (dr > 0 && span.row + 1 == this->row_count))
+					{
+						continue;
+					}
+
+					unsigned int r = span.row + dr;
+					const unsigned char* line = this->cells + static_cast<size_t>(r) * this->col_count;
+
+					for (unsigned int c = first; c <= last; ++c)
+					{
+						if (line[c] == 0)
+						{
+							c = this->openRun(r, c);
+						}
+						else
+						{
+							this->revealBorder(this->cellIndex(r, c));
+						}
+					}
+				}
+			}
+
+		}
+
+
+
+	public:
+
+		/*
+
+			Desc: Constructs A New Engine Instance With Specified Dimensions
+			And Mine Count. The Engine Holds No Rendering State And Can Run
+			Without Any OpenGL Context.
+
+			Preconditions:
+				1.) All Parameters Must Be Valid Positive Values
+
+			Postconditions:
+				1.) Engine Instance Will Be Created With Specified Dimensions
+				2.) Engine Will Be Ready For initialize() Call
+
+		*/
+		Engine(const unsigned int& row_count = CONFIG::BOARD::ROW_COUNT,
+			const unsigned int& col_count = CONFIG::BOARD::COL_COUNT,
+			const unsigned int& mineCount = CONFIG::BOARD::MINE_COUNT) :
+			row_count(row_count), col_count(col_count), mineCount(mineCount)
+		{
+		}
+
+
+		/*
+
+			Desc: Allocates The Cell Grid And Places The Mines For The First Game
+			From The Given Seed.
+
+			Preconditions:
+				1.) Engine Must Not Already Be Initialized
+
+			Postconditions:
+				1.) Cells Will Be Allocated And Mines Will Be Placed
+				2.) isInit Flag Will Be Set To true
+
+		*/
+		bool initialize(uint64_t seed)
+		{
+
+			if (this->isInit)
+			{
+				return false;
+			}
+
+			this->seed = seed;
+			this->populateBoard();
+			this->loadBoard();
+
+			this->isInit = true;
+
+			return true;
+
+		}
+
+
+		/*
+
+			Desc: Starts A New Game On The Already Allocated Grid By Clearing
+			Every Cell And Placing A Fresh Set Of Mines From The Given Seed.
+
+			Preconditions:
+				1.) Engine Must Be Initialized
+
+			Postconditions:
+				1.) All Cells Will Be Hidden With A New Mine Layout
+				2.) changedCells Will Be Cleared
+
+		*/
+		void newGame(uint64_t seed)
+		{
+
+			this->seed = seed;
+			this->resetBoard();
+			this->loadBoard();
+
+			this->changedCells.clear();
+
+		}
+
+
+		/*
+
+			Desc: Reveals The Given Cell, Flood Filling Empty Regions And
+			Revealing Every Mine If A Mine Was Hit.
+
+			Preconditions:
+				1.) row And col Must Be Valid Cell Coordinates
+				2.) Engine Must Be Initialized
+
+			Postconditions:
+				1.) Flagged Cells Will Be Ignored
+				2.) If Cell Is A Mine, All Mines Will Be Revealed, gameState Will Be
+				    LOST And true Returned
+				3.) If Cell Is Empty, Its Precomputed Opening Is Revealed, Or bloomOut
+				    Is Called When No Index Is Built Or The Opening Was Flagged
+				4.) Every Cell Whose State Changed Will Be Recorded In changedCells
+				5.) gameState Will Be WON Once The Last Safe Cell Is Revealed
+
+		*/
+		bool reveal(unsigned int row, unsigned int col)
+		{
+
+			unsigned int index = this->cellIndex(row, col);
+
+			if (this->stateAt(index) == CellState::FLAGGED)
+			{
+				return false; // Ignore Clicks On Flagged Cells
+			}
+
+			if (this->mineAt(index))
+			{
+				// Reveal All Mines
+				for (unsigned int mine : this->mineIndices)
+				{
+					this->setState(mine, CellState::REVEALED);
+					this->changedCells.push_back(mine);
+				}
+
+				this->gameState = GameState::LOST;
+				return true;
+			}
+
+			// Update Cell State
+			if (this->cells[index] == 0)
+			{
+				unsigned int region = this->openings.isBuilt() ? this->openings.getRegion(index) : OpeningIndex::NONE;
+
+				if (region != OpeningIndex::NONE && !this->openings.isFlagged(region))
+				{
+					this->revealOpening(region);
+				}
+				else
+				{
+					this->bloomOut(row, col);
+				}
+			}
+			else if (this->stateAt(index) == CellState::HIDDEN)
+			{
+				this->setState(index, CellState::REVEALED);
+				this->changedCells.push_back(index);
+			}
+
+			// Won Once Every Safe Cell Is Open
+			if (this->gameState == GameState::PLAYING && this->getHiddenSafeCount() == 0)
+			{
+				this->gameState = GameState::WON;
+			}
+
+			return false;
+
+		}
+
+
+		/*
+
+			Desc: Toggles The Flag State Of A Cell Between Hidden And Flagged
+			Allowing Players To Mark Suspected Mine Locations.
+
+			Preconditions:
+				1.) row And col Must Be Valid Cell Coordinates
+				2.) Engine Must Be Initialized
+
+			Postconditions:
+				1.) HIDDEN Cells Will Become FLAGGED
+				2.) FLAGGED Cells Will Become HIDDEN
+				3.) REVEALED Cells Will Remain Unchanged
+				4.) Flagging A Zero Cell Marks Its Opening For The Flood Fill
+
+		*/
+		void toggleFlag(unsigned int row, unsigned int col)
+		{
+
+			unsigned int index = this->cellIndex(row, col);
+			unsigned int region = this->openings.isBuilt() ? this->openings.getRegion(index) : OpeningIndex::NONE;
+
+			if (this->stateAt(index) == CellState::HIDDEN)
+			{
+				this->setState(index, CellState::FLAGGED);
+				this->changedCells.push_back(index);
+
+				if (region != OpeningIndex::NONE) this->openings.markFlagged(region);
+			}
+			else if (this->stateAt(index) == CellState::FLAGGED)
+			{
+				this->setState(index, CellState::HIDDEN);
+				this->changedCells.push_back(index);
+
+			}
+
+		}
+
+
+		/*
+
+			Desc: Query Accessors For The Board Dimensions, Per-Cell State And
+			Live Counters. The Counters Are Kept Up To Date On Every Change, So
+			Win Checks And Mine Tallies Never Scan The Grid.
+
+			Preconditions:
+				1.) row And col Must Be Valid Cell Coordinates
+				2.) Engine Must Be Initialized
+
+			Postconditions:
+				1.) Returns The Requested Value Without Modifying The Board
+
+		*/
+		unsigned int getRowCount() const { return this->row_count; }
+		unsigned int getColCount() const { return this->col_count; }
+		unsigned int getMineCount() const { return this->mineCount; }
+		uint64_t getSeed() const { return this->seed; }
+		CellState getState(unsigned int row, unsigned int col) const { return this->stateAt(this->cellIndex(row, col)); }
+		unsigned int getAdjacentMines(unsigned int row, unsigned int col) const { return this->countAt(this->cellIndex(row, col)); }
+		bool isMine(unsigned int row, unsigned int col) const { return this->mineAt(this->cellIndex(row, col)); }
+		unsigned long long getHiddenSafeCount() const { return static_cast<unsigned long long>(this->row_count) * this->col_count - this->mineCount - this->revealedSafe; }
+		unsigned int getRevealedSafeCount() const { return this->revealedSafe; }
+		unsigned int getFlagCount() const { return this->flagCount; }
+		long long getRemainingMines() const { return static_cast<long long>(this->mineCount) - this->flagCount; }
+		GameState getGameState() const { return this->gameState; }
+		const std::vector<unsigned int>& getMineIndices() const { return this->mineIndices; }
+		const OpeningIndex& getOpenings() const { return this->openings; }
+		const unsigned char* getCells() const { return this->cells; }
+
+
+		/*
+
+			Desc: Enables Or Disables The Precomputed Opening Index. Takes Effect
+			From The Next initialize() Or newGame() Call.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) precomputeOpenings Will Be Set To enabled
+
+		*/
+		void setPrecomputeOpenings(bool enabled)
+		{
+
+			this->precomputeOpenings = enabled;
+
+		}
+
+
+		/*
+
+			Desc: Returns The Linear Indices (row * col_count + col) Of Every
+			Cell Whose State Changed Since The Last clearChanges() Call, So A
+			Renderer Can Update Only What Moved.
+
+			Preconditions:
+				1.) Engine Must Be Initialized
+
+			Postconditions:
+				1.) Returns A Reference To The Pending Change List
+
+		*/
+		const std::vector<unsigned int>& getChangedCells() const
+		{
+
+			return this->changedCells;
+
+		}
+
+
+		/*
+
+			Desc: Clears The Pending Change List Once A Consumer Has Processed It.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) changedCells Will Be Empty
+
+		*/
+		void clearChanges()
+		{
+
+			this->changedCells.clear();
+
+		}
+
+
+		/*
+
+			Desc: Cleanup Routine For The Engine Freeing The Cell Grid.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) cells Array Will Be Deleted If Allocated
+
+		*/
+		~Engine()
+		{
+
+			delete[] this->cells;
+
+		}
+
+};
\ No newline at end of file
@@ -0,0 +1,422 @@
+#pragma once
+
+
+
+#include <glad/glad.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "config.h"
+
+
+class FrameProfiler
+{
+
+	public:
+
+		// ~~~~~~ Timed Sections (GPU Timers First, As They Index The Query Sets), Then Click Latencies From LatencyTracker ~~~~~~
+		enum Timer { GPU_QUAD, GPU_BOARD, CPU_EVENTS, CPU_CLICK, CPU_UPLOAD, INPUT_UPDATE, INPUT_UPLOAD, INPUT_PRESENT, TIMER_COUNT };
+
+
+		// ~~~~~~ Rolling Statistics Of One Timer, In Milliseconds ~~~~~~
+		struct Percentiles
+		{
+			double p50 = 0.0;
+			double p99 = 0.0;
+			double max = 0.0;
+			size_t samples = 0;
+		};
+
+
+		/*
+
+			Desc: Times The Enclosing Scope On The CPU, Recording Its Duration
+			Under timer When The Scope Exits (Early Returns Included).
+
+			Preconditions:
+				1.) timer Must Be A CPU Timer
+
+			Postconditions:
+				1.) One Sample Will Be Recorded If Profiling Is Enabled
+
+		*/
+		class CpuScope
+		{
+
+			private:
+
+				Timer timer;
+				std::chrono::steady_clock::time_point start;
+
+			public:
+
+				explicit CpuScope(Timer timer) : timer(timer), start(std::chrono::steady_clock::now()) {}
+
+				~CpuScope()
+				{
+					FrameProfiler::get().record(this->timer,
+						std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - this->start).count());
+				}
+
+		};
+
+
+
+	private:
+
+		static constexpr unsigned int GPU_TIMERS = CPU_EVENTS;
+		static constexpr unsigned int QUERY_SLOTS = 2;			// Frames A Query Set Has To Finish Before It Is Read
+
+
+		// ~~~~~~ Rolling Samples Per Timer, Overwritten Oldest First ~~~~~~
+		std::vector<double> samples[TIMER_COUNT];
+		size_t nextSample[TIMER_COUNT] = {};
+
+
+		// ~~~~~~ GL_TIME_ELAPSED Queries, One Set Per Frame Slot ~~~~~~
+		GLuint queries[QUERY_SLOTS][GPU_TIMERS] = {};
+		bool pending[QUERY_SLOTS][GPU_TIMERS] = {};
+		unsigned int slot = 0;
+		bool hasQueries = false;
+		unsigned long long droppedQueries = 0;
+
+
+		FrameProfiler() = default;
+
+
+
+	public:
+
+		/*
+
+			Desc: Returns The Profiler For The Current Context. The Game Uses A
+			Single Context, Like GLState, And The Timed Sections Live In
+			Several Classes, So One Instance Collects Them All.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Shared Profiler
+
+		*/
+		static FrameProfiler& get()
+		{
+
+			static FrameProfiler profiler;
+			return profiler;
+
+		}
+
+
+		/*
+
+			Desc: Creates The GPU Timer Queries. Timer Queries Are Core In GL
+			3.3, So Only CONFIG::PROFILER::ENABLED Decides Whether They Exist.
+
+			Preconditions:
+				1.) OpenGL Context Must Be Active
+
+			Postconditions:
+				1.) QUERY_SLOTS Sets Of Queries Will Exist If Profiling Is Enabled
+
+		*/
+		void initialize()
+		{
+
+			if (!CONFIG::PROFILER::ENABLED || this->hasQueries)
+			{
+				return;
+			}
+
+			glGenQueries(QUERY_SLOTS * GPU_TIMERS, &this->queries[0][0]);
+			this->hasQueries = true;
+
+		}
+
+
+		/*
+
+			Desc: Deletes The GPU Timer Queries, Keeping The Samples So They Can
+			Still Be Printed And Exported.
+
+			Preconditions:
+				1.) The Context initialize Ran In Must Be Current
+
+			Postconditions:
+				1.) No Queries Will Be Pending Or Allocated
+
+		*/
+		void terminate()
+		{
+
+			if (!this->hasQueries)
+			{
+				return;
+			}
+
+			glDeleteQueries(QUERY_SLOTS * GPU_TIMERS, &this->queries[0][0]);
+
+			for (unsigned int i = 0; i < QUERY_SLOTS; ++i)
+			{
+				std::fill(this->pending[i], this->pending[i] + GPU_TIMERS, false);
+			}
+
+			this->hasQueries = false;
+
+		}
+
+
+		/*
+
+			Desc: Brackets GPU Work With A GL_TIME_ELAPSED Query Of This Frame's
+			Slot. Only One Timer Query May Be Active At A Time, So GPU Timers
+			Must Not Nest.
+
+			Preconditions:
+				1.) timer Must Be A GPU Timer, With No Other GPU Timer Open
+
+			Postconditions:
+				1.) The Work Between beginGpu And endGpu Will Be Timed
+
+		*/
+		void beginGpu(Timer timer)
+		{
+
+			if (this->hasQueries)
+			{
+				glBeginQuery(GL_TIME_ELAPSED, this->queries[this->slot][timer]);
+				this->pending[this->slot][timer] = true;
+			}
+
+		}
+
+		void endGpu()
+		{
+
+			if (this->hasQueries)
+			{
+				glEndQuery(GL_TIME_ELAPSED);
+			}
+
+		}
+
+
+		/*
+
+			Desc: Ends The Frame And Moves To The Next Query Slot, Collecting The
+			Results That Slot Holds From QUERY_SLOTS - 1 Frames Ago. A Result The
+			GPU Has Still Not Produced Is Dropped Rather Than Waited For, So The
+			Profiler Never Stalls The Pipeline It Is Measuring.
+
+			Preconditions:
+				1.) No GPU Timer May Be Open
+
+			Postconditions:
+				1.) Every Finished Query Of The New Slot Will Be Recorded
+				2.) The New Slot's Queries Will Be Free For This Frame
+
+		*/
+		void endFrame()
+		{
+
+			if (!this->hasQueries)
+			{
+				return;
+			}
+
+			this->slot = (this->slot + 1) % QUERY_SLOTS;
+
+			for (unsigned int timer = 0; timer < GPU_TIMERS; ++timer)
+			{
+				if (!this->pending[this->slot][timer])
+				{
+					continue;
+				}
+
+				GLuint available = GL_FALSE;
+				glGetQueryObjectuiv(this->queries[this->slot][timer], GL_QUERY_RESULT_AVAILABLE, &available);
+
+				if (available)
+				{
+					GLuint64 elapsed = 0;
+					glGetQueryObjectui64v(this->queries[this->slot][timer], GL_QUERY_RESULT, &elapsed);
+					this->record(static_cast<Timer>(timer), elapsed / 1.0e6);
+				}
+				else
+				{
+					++this->droppedQueries;
+				}
+
+				this->pending[this->slot][timer] = false;
+			}
+
+		}
+
+
+		/*
+
+			Desc: Adds One Sample To timer's Rolling Window, Replacing The
+			Oldest Once CONFIG::PROFILER::SAMPLE_WINDOW Are Held.
+
+			Preconditions:
+				1.) milliseconds Must Not Be Negative
+
+			Postconditions:
+				1.) The Sample Will Count Toward timer's Percentiles
+
+		*/
+		void record(Timer timer, double milliseconds)
+		{
+
+			if (!CONFIG::PROFILER::ENABLED)
+			{
+				return;
+			}
+
+			std::vector<double>& window = this->samples[timer];
+
+			if (window.size() < CONFIG::PROFILER::SAMPLE_WINDOW)
+			{
+				window.push_back(milliseconds);
+			}
+			else
+			{
+				window[this->nextSample[timer]] = milliseconds;
+				this->nextSample[timer] = (this->nextSample[timer] + 1) % window.size();
+			}
+
+		}
+
+
+		/*
+
+			Desc: Computes The Median, 99th Percentile (Nearest Rank) And Worst
+			Sample Of timer's Rolling Window.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Statistics, All Zero If timer Has No Samples
+
+		*/
+		Percentiles getPercentiles(Timer timer) const
+		{
+
+			Percentiles result;
+			std::vector<double> sorted = this->samples[timer];
+
+			if (sorted.empty())
+			{
+				return result;
+			}
+
+			std::sort(sorted.begin(), sorted.end());
+
+			result.samples = sorted.size();
+			result.p50 = sorted[(sorted.size() - 1) / 2];
+			result.p99 = sorted[(sorted.size() * 99 + 99) / 100 - 1];
+			result.max = sorted.back();
+
+			return result;
+
+		}
+
+
+		/*
+
+			Desc: Returns The Label Used For timer In Reports And Exports.
+
+			Preconditions:
+				1.) timer Must Be Less Than TIMER_COUNT
+
+			Postconditions:
+				1.) Returns A Static String
+
+		*/
+		static const char* getName(Timer timer)
+		{
+
+			static const char* names[TIMER_COUNT] = {
+				"GPU Window Quad", "GPU Board::render", "CPU glfwPollEvents", "CPU handleClick", "CPU updateVertexBuffer",
+				"Click To Board Update", "Click To Upload", "Click To Photon (Fence)"
+			};
+
+			return names[timer];
+
+		}
+
+
+		/*
+
+			Desc: Prints One Line Of Percentiles Per Timer That Has Samples.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) The Report Will Be Written To out
+
+		*/
+		void print(std::ostream& out) const
+		{
+
+			for (unsigned int timer = 0; timer < TIMER_COUNT; ++timer)
+			{
+				Percentiles stats = this->getPercentiles(static_cast<Timer>(timer));
+
+				if (stats.samples > 0)
+				{
+					out << getName(static_cast<Timer>(timer)) << ": " << stats.p50 << " ms p50, " << stats.p99 << " ms p99, "
+						<< stats.max << " ms Max (" << stats.samples << " Samples)\n";
+				}
+			}
+
+			if (this->droppedQueries > 0)
+			{
+				out << "GPU Timer Results Dropped Rather Than Waited For: " << this->droppedQueries << "\n";
+			}
+
+		}
+
+
+		/*
+
+			Desc: Writes The Percentiles Of Every Timer As CSV, Tagged With The
+			Renderer They Were Measured On, So Runs On Different Machines Can
+			Be Compared For Regressions.
+
+			Preconditions:
+				1.) OpenGL Context Must Be Active (For The Renderer String)
+
+			Postconditions:
+				1.) path Will Hold A Header Row And One Row Per Timer
+				2.) Returns false If The File Could Not Be Written
+
+		*/
+		bool exportTo(const std::string& path) const
+		{
+
+			std::ofstream file(path, std::ios::trunc);
+			const GLubyte* renderer = glGetString(GL_RENDERER);
+
+			file << "timer,samples,p50_ms,p99_ms,max_ms,renderer\n";
+
+			for (unsigned int timer = 0; timer < TIMER_COUNT; ++timer)
+			{
+				Percentiles stats = this->getPercentiles(static_cast<Timer>(timer));
+
+				file << getName(static_cast<Timer>(timer)) << "," << stats.samples << "," << stats.p50 << "," << stats.p99
+					 << "," << stats.max << ",\"" << (renderer ? reinterpret_cast<const char*>(renderer) : "") << "\"\n";
+			}
+
+			return static_cast<bool>(file);
+
+		}
+
+};
\ No newline at end of file
@@ -0,0 +1,218 @@
+#pragma once
+
+
+
+#include "adjacency.h"
+#include "placement.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+
+class TiledGenerator
+{
+
+	private:
+
+		// ~~~~~~ Target Cells Per Tile (Tiles Are Whole Row Bands) ~~~~~~
+		static constexpr unsigned int TILE_CELLS = 1u << 20;
+
+
+		/*
+
+			Desc: Derives The Seed Of A Single Tile From The Board Seed. The
+			Tile Index Acts As A Counter, So Every Tile's Stream Is Fixed By
+			(seed, tile) Alone And Never By Which Thread Picks It Up.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns A Well-Mixed 64-Bit Seed For The Tile
+
+		*/
+		static uint64_t tileSeed(uint64_t seed, uint64_t tile)
+		{
+
+			uint64_t key = seed ^ (0xD1B54A32D192ED03ULL * (tile + 1));
+			return Xoshiro256::splitMix64(key);
+
+		}
+
+
+		/*
+
+			Desc: Runs task(tile) For Every Tile On Up To threadCount Threads,
+			Each Pulling The Next Tile From A Shared Counter. Returns Once All
+			Tiles Are Done, So Consecutive Calls Act As A Barrier.
+
+			Preconditions:
+				1.) threadCount Must Be At Least 1
+
+			Postconditions:
+				1.) task Will Have Been Called Exactly Once Per Tile
+
+		*/
+		template <typename Task>
+		static void forEachTile(unsigned int tileCount, unsigned int threadCount, const Task& task)
+		{
+
+			std::atomic<unsigned int> nextTile(0);
+
+			auto worker = [&]()
+			{
+				for (unsigned int tile = nextTile++; tile < tileCount; tile = nextTile++)
+				{
+					task(tile);
+				}
+			};
+
+			std::vector<std::thread> pool;
+
+			for (unsigned int i = 1; i < threadCount; ++i)
+			{
+				pool.emplace_back(worker);
+			}
+
+			worker();
+
+			for (std::thread& thread : pool)
+			{
+				thread.join();
+			}
+
+		}
+
+
+
+	public:
+
+		/*
+
+			Desc: Returns The Number Of Rows In Each Tile For A Board Of The
+			Given Width. Depends Only On The Board Shape.
+
+			Preconditions:
+				1.) col_count Must Be Greater Than 0
+
+			Postconditions:
+				1.) Returns At Least 1
+
+		*/
+		static unsigned int getTileRows(unsigned int col_count)
+		{
+
+			return std::max(1u, TILE_CELLS / col_count);
+
+		}
+
+
+		/*
+
+			Desc: Generates A Board In Row-Band Tiles Spread Over A Thread Pool.
+			Mines Are Split Into Exact Per-Tile Quotas (Each Tile's Proportional
+			Share, With The Few Leftover Mines Handed To Tiles Drawn From The
+			Board Seed), And Each Tile Places Its Quota With MinePlacer Seeded
+			From (seed, tile). In The First Pass Every Tile Zeroes Its Band,
+			Places Its Mines And Copies Its First And Last Rows Out As Halos; In
+			The Second Pass Every Tile Counts Its Band Against Its Neighbours'
+			Halos. The Result Is Identical For Any threadCount.
+
+			Preconditions:
+				1.) cells Must Hold row_count * col_count Bytes
+				2.) mineCount Must Not Exceed row_count * col_count
+
+			Postconditions:
+				1.) Each Cell Will Hold Its Adjacent Count And mineBit If A Mine
+				2.) mineIndices Will Hold The Linear Index Of Every Mine, Tile By Tile
+				3.) The Same seed Will Always Produce The Same Board
+
+		*/
+		static void generate(uint64_t seed, unsigned char* cells, unsigned int row_count, unsigned int col_count,
+			unsigned int mineCount, unsigned char mineBit, std::vector<unsigned int>& mineIndices,
+			unsigned int threadCount = 0)
+		{
+
+			unsigned int tileRows = getTileRows(col_count);
+			unsigned int tileCount = (row_count + tileRows - 1) / tileRows;
+			uint64_t cellCount = static_cast<uint64_t>(row_count) * col_count;
+
+			// Proportional Quotas, Then Leftovers To Distinct Tiles Chosen From The Seed
+			std::vector<unsigned int> quota(tileCount);
+			std::vector<unsigned int> offset(tileCount + 1, 0);
+			unsigned int assigned = 0;
+
+			for (unsigned int t = 0; t < tileCount; ++t)
+			{
+				uint64_t tileCells = static_cast<uint64_t>(std::min(tileRows, row_count - t * tileRows)) * col_count;
+				quota[t] = static_cast<unsigned int>(mineCount * tileCells / cellCount);
+				assigned += quota[t];
+			}
+
+			std::vector<unsigned int> extra;
+			MinePlacer::place(tileSeed(seed, tileCount), tileCount, mineCount - assigned, extra);
+
+			for (unsigned int t : extra)
+			{
+				++quota[t];
+			}
+
+			for (unsigned int t = 0; t < tileCount; ++t)
+			{
+				offset[t + 1] = offset[t] + quota[t];
+			}
+
+			mineIndices.resize(mineCount);
+
+			// First And Last Row Of Each Tile, Published For Its Neighbours
+			std::vector<unsigned char> halos(static_cast<size_t>(tileCount) * 2 * col_count);
+
+			if (threadCount == 0)
+			{
+				threadCount = std::max(1u, std::thread::hardware_concurrency());
+			}
+
+			threadCount = std::min(threadCount, tileCount);
+
+			// Pass 1: Zero, Place And Publish Halos
+			forEachTile(tileCount, threadCount, [&](unsigned int t)
+			{
+				unsigned int firstRow = t * tileRows;
+				unsigned int rows = std::min(tileRows, row_count - firstRow);
+				unsigned int base = firstRow * col_count;
+				unsigned char* band = cells + base;
+
+				memset(band, 0, static_cast<size_t>(rows) * col_count);
+
+				unsigned int* tileMines = mineIndices.data() + offset[t];
+				MinePlacer::place(tileSeed(seed, t), rows * col_count, quota[t], tileMines);
+
+				for (unsigned int i = 0; i < quota[t]; ++i)
+				{
+					band[tileMines[i]] = mineBit;
+					tileMines[i] += base;
+				}
+
+				unsigned char* halo = halos.data() + static_cast<size_t>(t) * 2 * col_count;
+				memcpy(halo, band, col_count);
+				memcpy(halo + col_count, band + static_cast<size_t>(rows - 1) * col_count, col_count);
+			});
+
+			// Pass 2: Count Each Band Against The Neighbouring Tiles' Halos
+			forEachTile(tileCount, threadCount, [&](unsigned int t)
+			{
+				unsigned int firstRow = t * tileRows;
+				unsigned int rows = std::min(tileRows, row_count - firstRow);
+
+				const unsigned char* above = t > 0 ? halos.data() + (static_cast<size_t>(t - 1) * 2 + 1) * col_count : nullptr;
+				const unsigned char* below = t + 1 < tileCount ? halos.data() + static_cast<size_t>(t + 1) * 2 * col_count : nullptr;
+
+				AdjacencyKernel::countBand(cells + static_cast<size_t>(firstRow) * col_count, rows, col_count, above, below, mineBit);
+			});
+
+		}
+
+};
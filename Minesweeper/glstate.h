@@ -0,0 +1,195 @@
+#pragma once
+
+
+
+#include <glad/glad.h>
+
+
+class GLState
+{
+
+	public:
+
+		// ~~~~~~ Texture Units Tracked (Atlas On 0, Board State On 1, LOD Pyramid On 2, Cell Records On 3) ~~~~~~
+		static constexpr unsigned int TEXTURE_UNITS = 4;
+
+
+	private:
+
+		// ~~~~~~ Bound Objects As Last Set Through The Tracker ~~~~~~
+		GLuint program = 0;
+		GLuint vertexArray = 0;
+		GLuint arrayBuffer = 0;
+		unsigned int activeUnit = 0;
+		GLuint textures[TEXTURE_UNITS] = {};
+
+
+		// ~~~~~~ Call Counters Since The Last beginFrame ~~~~~~
+		unsigned long long issued = 0;
+		unsigned long long skipped = 0;
+
+
+		GLState() = default;
+
+
+
+	public:
+
+		/*
+
+			Desc: Returns The Tracker For The Current Context. The Game Uses A
+			Single Context, So One Instance Mirrors All Binding State.
+
+			Preconditions:
+				1.) All Binds Must Go Through The Tracker For Its Cache To Hold
+
+			Postconditions:
+				1.) Returns The Shared Tracker
+
+		*/
+		static GLState& get()
+		{
+
+			static GLState state;
+			return state;
+
+		}
+
+
+		/*
+
+			Desc: Binding Wrappers. Each Issues Its GL Call Only When The Object
+			Differs From The One Already Bound, Counting The Rest As Skipped.
+			GL_ELEMENT_ARRAY_BUFFER Is Not Tracked As It Belongs To The Bound VAO.
+			bindTexture Binds To target, GL_TEXTURE_2D Unless A Unit Holds Another
+			Kind (The Cell Record Buffer Texture).
+
+			Preconditions:
+				1.) OpenGL Context Must Be Active
+				2.) unit Must Be Less Than TEXTURE_UNITS
+
+			Postconditions:
+				1.) The Requested Object Will Be Bound
+				2.) issued Or skipped Will Be Incremented Per GL Call
+
+		*/
+		void useProgram(GLuint id)
+		{
+
+			if (this->program == id) { ++this->skipped; return; }
+
+			glUseProgram(id);
+			this->program = id;
+			++this->issued;
+
+		}
+
+		void bindVertexArray(GLuint id)
+		{
+
+			if (this->vertexArray == id) { ++this->skipped; return; }
+
+			glBindVertexArray(id);
+			this->vertexArray = id;
+			++this->issued;
+
+		}
+
+		void bindArrayBuffer(GLuint id)
+		{
+
+			if (this->arrayBuffer == id) { ++this->skipped; return; }
+
+			glBindBuffer(GL_ARRAY_BUFFER, id);
+			this->arrayBuffer = id;
+			++this->issued;
+
+		}
+
+		void bindTexture(unsigned int unit, GLuint id, GLenum target = GL_TEXTURE_2D)
+		{
+
+			if (this->textures[unit] == id) { ++this->skipped; return; }
+
+			if (this->activeUnit != unit)
+			{
+				glActiveTexture(GL_TEXTURE0 + unit);
+				this->activeUnit = unit;
+				++this->issued;
+			}
+
+			glBindTexture(target, id);
+			this->textures[unit] = id;
+			++this->issued;
+
+		}
+
+
+		/*
+
+			Desc: Makes unit The Active Texture Unit With id Bound, Ready For
+			glTex* Calls That Act On The Active Unit (Uploads, Parameters).
+
+			Preconditions:
+				1.) unit Must Be Less Than TEXTURE_UNITS
+
+			Postconditions:
+				1.) unit Will Be Active With id Bound To GL_TEXTURE_2D
+
+		*/
+		void selectTexture(unsigned int unit, GLuint id)
+		{
+
+			this->bindTexture(unit, id);
+
+			if (this->activeUnit != unit)
+			{
+				glActiveTexture(GL_TEXTURE0 + unit);
+				this->activeUnit = unit;
+				++this->issued;
+			}
+
+		}
+
+
+		/*
+
+			Desc: Issues Any Other GL Call (Draws, Uniforms, Uploads) So It Is
+			Included In The Per-Frame Call Count.
+
+			Preconditions:
+				1.) function Must Be A Loaded GL Entry Point
+
+			Postconditions:
+				1.) function Will Have Been Called With args
+				2.) issued Will Be Incremented
+
+		*/
+		template <typename Function, typename... Args>
+		void call(Function function, Args... args)
+		{
+
+			++this->issued;
+			function(args...);
+
+		}
+
+
+		/*
+
+			Desc: Per-Frame Call Counters. beginFrame Resets Them; getIssued Is
+			The Number Of GL Calls Made Through The Tracker Since, getSkipped The
+			Redundant Binds It Dropped.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns Or Resets The Counters
+
+		*/
+		void beginFrame() { this->issued = 0; this->skipped = 0; }
+		unsigned long long getIssued() const { return this->issued; }
+		unsigned long long getSkipped() const { return this->skipped; }
+
+};
\ No newline at end of file
@@ -0,0 +1,326 @@
+#pragma once
+
+
+
+#include "config.h"
+
+
+class GlyphAtlas
+{
+
+	public:
+
+		// ~~~~~~ Atlas Layout (One CHAR_WIDTH Slot Per Digit, Then The Flag) ~~~~~~
+		static constexpr unsigned int WIDTH = CONFIG::SHADER::TEXT_ATLAS::ATLAS_WIDTH;
+		static constexpr unsigned int HEIGHT = CONFIG::SHADER::TEXT_ATLAS::ATLAS_HEIGHT;
+
+
+		// ~~~~~~ Texel Storage (Grayscale: 0 = Black, 255 = White) ~~~~~~
+		struct Texels
+		{
+			unsigned char data[WIDTH * HEIGHT];
+		};
+
+
+
+	private:
+
+		/*
+
+			Desc: Draws One 8x16 Bit Pattern Into Its Atlas Slot, Inset By 20%
+			On Each Side, Each Set Bit As A 2x2 Texel Block For Visibility.
+
+			Preconditions:
+				1.) slot Must Be Less Than CONFIG::SHADER::TEXT_ATLAS::TOTAL_CHARS
+
+			Postconditions:
+				1.) The Pattern's Texels Will Be Set To 255 In atlas
+
+		*/
+		static constexpr void drawPattern(Texels& atlas, unsigned int slot, const unsigned char (&pattern)[16])
+		{
+
+			unsigned int charSlotWidth = CONFIG::SHADER::TEXT_ATLAS::CHAR_WIDTH;
+			unsigned int charSlotHeight = HEIGHT;
+
+			// Calculate Padding (20% On Each Side)
+			unsigned int horizontalPadding = static_cast<unsigned int>(charSlotWidth * 0.2f);
+			unsigned int verticalPadding = static_cast<unsigned int>(charSlotHeight * 0.2f);
+
+			// Calculate Actual Character Area
+			unsigned int actualCharWidth = charSlotWidth - 2 * horizontalPadding;
+			unsigned int actualCharHeight = charSlotHeight - 2 * verticalPadding;
+
+			// Starting Position For This Glyph (With Padding)
+			unsigned int startX = slot * charSlotWidth + horizontalPadding;
+			unsigned int startY = verticalPadding;
+
+			for (unsigned int row = 0; row < 16; ++row)
+			{
+				// Scale Row To Fit In Actual Character Area
+				unsigned int scaledY = startY + (row * actualCharHeight) / 16;
+
+				for (unsigned int col = 0; col < 8; ++col)
+				{
+					if (!(pattern[row] & (0b10000000 >> col)))
+					{
+						continue;
+					}
+
+					// Scale Column To Fit In Actual Character Area
+					unsigned int scaledX = startX + (col * actualCharWidth) / 8;
+
+					for (unsigned int y = scaledY; y < scaledY + 2 && y < HEIGHT; ++y)
+					{
+						for (unsigned int x = scaledX; x < scaledX + 2 && x < WIDTH; ++x)
+						{
+							atlas.data[y * WIDTH + x] = 255;
+						}
+					}
+				}
+			}
+
+		}
+
+
+		/*
+
+			Desc: Rasterizes The Hand-Drawn Digit (0-9) And Flag Patterns Into
+			A Binary Atlas.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Atlas, Glyph Texels 255 And Everything Else 0
+
+		*/
+		static constexpr Texels rasterize()
+		{
+
+			// 8x16 Bit Patterns For Digits 0-9 (Each Row Is A Byte)
+			const unsigned char digitPatterns[10][16] = {
+				// 0
+				{0b01111110, 0b11000011, 0b11000011, 0b11000011,
+				 0b11000011, 0b11001011, 0b11010011, 0b11100011,
+				 0b11000011, 0b11000011, 0b11000011, 0b11000011,
+				 0b11000011, 0b11000011, 0b11000011, 0b01111110},
+
+				// 1
+				{0b00011000, 0b00111000, 0b01111000, 0b00011000,
+				 0b00011000, 0b00011000, 0b00011000, 0b00011000,
+				 0b00011000, 0b00011000, 0b00011000, 0b00011000,
+				 0b00011000, 0b00011000, 0b00011000, 0b11111111},
+
+				// 2
+				{0b01111110, 0b11000011, 0b11000011, 0b00000011,
+				 0b00000011, 0b00000110, 0b00001100, 0b00011000,
+				 0b00110000, 0b01100000, 0b11000000, 0b11000000,
+				 0b11000000, 0b11000000, 0b11111111, 0b11111111},
+
+				// 3
+				{0b01111110, 0b11000011, 0b11000011, 0b00000011,
+				 0b00000011, 0b00000110, 0b00111100, 0b00000110,
+				 0b00000011, 0b00000011, 0b11000011, 0b11000011,
+				 0b11000011, 0b11000011, 0b11000011, 0b01111110},
+
+				// 4
+				{0b11000011, 0b11000011, 0b11000011, 0b11000011,
+				 0b11000011, 0b11000011, 0b11111111, 0b11111111,
+				 0b00000011, 0b00000011, 0b00000011, 0b00000011,
+				 0b00000011, 0b00000011, 0b00000011, 0b00000011},
+
+				// 5
+				{0b11111111, 0b11111111, 0b11000000, 0b11000000,
+				 0b11000000, 0b11000000, 0b11111110, 0b01111111,
+				 0b00000011, 0b00000011, 0b00000011, 0b11000011,
+				 0b11000011, 0b11000011, 0b11000011, 0b01111110},
+
+				// 6
+				{0b01111110, 0b11000011, 0b11000011, 0b11000000,
+				 0b11000000, 0b11000000, 0b11111110, 0b11111111,
+				 0b11000011, 0b11000011, 0b11000011, 0b11000011,
+				 0b11000011, 0b11000011, 0b11000011, 0b01111110},
+
+				// 7
+				{0b11111111, 0b11111111, 0b00000011, 0b00000011,
+				 0b00000110, 0b00000110, 0b00001100, 0b00001100,
+				 0b00011000, 0b00011000, 0b00110000, 0b00110000,
+				 0b01100000, 0b01100000, 0b11000000, 0b11000000},
+
+				// 8
+				{0b01111110, 0b11000011, 0b11000011, 0b11000011,
+				 0b11000011, 0b01111110, 0b01111110, 0b01111110,
+				 0b11000011, 0b11000011, 0b11000011, 0b11000011,
+				 0b11000011, 0b11000011, 0b11000011, 0b01111110},
+
+				// 9
+				{0b01111110, 0b11000011, 0b11000011, 0b11000011,
+				 0b11000011, 0b11000011, 0b11000011, 0b11111111,
+				 0b01111111, 0b00000011, 0b00000011, 0b00000011,
+				 0b11000011, 0b11000011, 0b11000011, 0b01111110}
+			};
+
+			const unsigned char flagPattern[16] = {
+				0b00000100, // Flagpole
+				0b11111100, // Full flag with pole
+				0b11111100, // Full flag
+				0b11111100, // Full flag
+				0b11111100, // Full flag
+				0b11111100, // Full flag
+				0b11111100, // Full flag
+				0b00001000, // Just pole
+				0b00001000, // Pole
+				0b00001000, // Pole
+				0b00001000, // Pole
+				0b00001000, // Pole
+				0b00001000, // Pole
+				0b00001000, // Pole
+				0b00001000, // Pole
+				0b11111111  // Base
+			};
+
+			Texels atlas = {};
+
+			for (unsigned int digit = 0; digit < CONFIG::SHADER::TEXT_ATLAS::NUM_DIGITS; ++digit)
+			{
+				drawPattern(atlas, digit, digitPatterns[digit]);
+			}
+
+			drawPattern(atlas, CONFIG::SHADER::TEXT_ATLAS::FLAG_INDEX, flagPattern);
+
+			return atlas;
+
+		}
+
+
+		/*
+
+			Desc: Square Root By Newton's Method, As std::sqrt Is Not constexpr.
+
+			Preconditions:
+				1.) value Must Be Positive
+
+			Postconditions:
+				1.) Returns sqrt(value) To Float Precision
+
+		*/
+		static constexpr float squareRoot(float value)
+		{
+
+			float root = value;
+
+			for (int i = 0; i < 16; ++i)
+			{
+				root = 0.5f * (root + value / root);
+			}
+
+			return root;
+
+		}
+
+
+		/*
+
+			Desc: Converts A Binary Atlas Into A Signed Distance Field. Each Texel
+			Stores Its Distance To The Glyph Edge (Halfway To The Nearest Texel
+			Of The Other Kind, Searched Within DISTANCE_SPREAD), Positive Inside,
+			Mapped So 0.5 Is The Edge. Texels Land On The Same Side Of 0.5 As In
+			The Bitmap, So The Shader's Threshold Draws The Same Glyph Under
+			Nearest Sampling, While Linear Sampling Interpolates The Edge Between
+			Texels And Keeps It Smooth However Far The Board Is Zoomed In.
+
+			Preconditions:
+				1.) bitmap Must Hold Only 0 And 255 Texels
+
+			Postconditions:
+				1.) Returns The Distance Field, Clamped To DISTANCE_SPREAD Texels
+
+		*/
+		static constexpr Texels distanceField(const Texels& bitmap)
+		{
+
+			const int spread = static_cast<int>(CONFIG::SHADER::TEXT_ATLAS::DISTANCE_SPREAD);
+			Texels field = {};
+
+			for (int y = 0; y < static_cast<int>(HEIGHT); ++y)
+			{
+				for (int x = 0; x < static_cast<int>(WIDTH); ++x)
+				{
+					bool inside = bitmap.data[y * WIDTH + x] != 0;
+					int nearest = (spread + 1) * (spread + 1);
+
+					for (int dy = -spread; dy <= spread; ++dy)
+					{
+						for (int dx = -spread; dx <= spread; ++dx)
+						{
+							int sx = x + dx, sy = y + dy;
+
+							// Beyond The Atlas Counts As Outside
+							bool other = sx < 0 || sy < 0 || sx >= static_cast<int>(WIDTH) || sy >= static_cast<int>(HEIGHT) ?
+								inside : (bitmap.data[sy * WIDTH + sx] != 0) != inside;
+
+							if (other && dx * dx + dy * dy < nearest)
+							{
+								nearest = dx * dx + dy * dy;
+							}
+						}
+					}
+
+					float distance = squareRoot(static_cast<float>(nearest)) - 0.5f;
+					distance = distance < spread ? distance : static_cast<float>(spread);
+
+					float value = 127.5f + (inside ? distance : -distance) * 127.5f / spread;
+					field.data[y * WIDTH + x] = static_cast<unsigned char>(value + 0.5f);
+				}
+			}
+
+			return field;
+
+		}
+
+
+		/*
+
+			Desc: Builds The Atlas In The Configured Encoding.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Bitmap, Or Its Distance Field If DISTANCE_FIELD Is Set
+
+		*/
+		static constexpr Texels build()
+		{
+
+			return CONFIG::SHADER::TEXT_ATLAS::DISTANCE_FIELD ? distanceField(rasterize()) : rasterize();
+
+		}
+
+
+
+	public:
+
+		/*
+
+			Desc: Returns The Atlas Texels, Which Are Computed By The Compiler
+			And Stored In The Executable, So The Only Work Left At Startup Is
+			The Texture Upload.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns WIDTH * HEIGHT Row-Major Texels
+
+		*/
+		static const unsigned char* getTexels()
+		{
+
+			static constexpr Texels texels = build();
+			return texels.data;
+
+		}
+
+};
\ No newline at end of file
@@ -0,0 +1,169 @@
+#pragma once
+
+
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+class InputScript
+{
+
+	public:
+
+		// ~~~~~~ One Scripted Input, At time Seconds After Replay Starts ~~~~~~
+		struct Event
+		{
+			double time;
+			bool quit;				// Close The Window Instead Of Clicking
+			bool rightClick;
+			double x, y;			// Cursor In Window Pixels, Origin Top Left As GLFW Reports It
+		};
+
+
+
+	private:
+
+		std::vector<Event> events;
+		size_t next = 0;
+
+
+
+	public:
+
+		/*
+
+			Desc: Reads A Script Of One Event Per Line, "SECONDS L X Y" For A
+			Left Click, "SECONDS R X Y" For A Right Click Or "SECONDS Q" To
+			Quit, With X And Y In Window Pixels. Blank Lines And Lines Starting
+			With # Are Skipped, And Events Are Replayed In Time Order.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) The Script Will Hold Every Event, Rewound To The Start
+				2.) Returns false, Having Reported The Offending Line, If The File
+				    Cannot Be Read Or A Line Is Malformed
+
+		*/
+		bool load(const std::string& path)
+		{
+
+			std::ifstream file(path);
+
+			if (!file.is_open())
+			{
+				std::cerr << "Failed To Open Input Script: " << path << "\n";
+				return false;
+			}
+
+			this->events.clear();
+			this->next = 0;
+
+			std::string line;
+
+			for (unsigned int number = 1; std::getline(file, line); ++number)
+			{
+				size_t first = line.find_first_not_of(" \t\r");
+
+				if (first == std::string::npos || line[first] == '#')
+				{
+					continue;
+				}
+
+				std::istringstream fields(line);
+				Event event = {};
+				std::string action;
+
+				bool valid = (fields >> event.time >> action) &&
+					(action == "Q" || ((action == "L" || action == "R") && (fields >> event.x >> event.y)));
+
+				if (!valid)
+				{
+					std::cerr << "Invalid Input Script Line " << number << ": " << line << " (Expected SECONDS L|R X Y Or SECONDS Q)\n";
+					return false;
+				}
+
+				event.quit = action == "Q";
+				event.rightClick = action == "R";
+				this->events.push_back(event);
+			}
+
+			std::stable_sort(this->events.begin(), this->events.end(),
+				[](const Event& a, const Event& b) { return a.time < b.time; });
+
+			return true;
+
+		}
+
+
+		/*
+
+			Desc: Hands Out The Next Event Once Its Time Has Come.
+
+			Preconditions:
+				1.) elapsed Must Be The Seconds Since Replay Started
+
+			Postconditions:
+				1.) Returns true And Fills event If One Was Due, Advancing The Script
+
+		*/
+		bool poll(double elapsed, Event& event)
+		{
+
+			if (this->next >= this->events.size() || this->events[this->next].time > elapsed)
+			{
+				return false;
+			}
+
+			event = this->events[this->next++];
+			return true;
+
+		}
+
+
+		/*
+
+			Desc: Seconds Until The Next Event Is Due, So A Sleeping Loop Can
+			Wake For It.
+
+			Preconditions:
+				1.) elapsed Must Be The Seconds Since Replay Started
+
+			Postconditions:
+				1.) Returns 0 If One Is Due, Or A Negative Value Once The Script Is Done
+
+		*/
+		double untilNext(double elapsed) const
+		{
+
+			if (this->next >= this->events.size())
+			{
+				return -1.0;
+			}
+
+			return std::max(this->events[this->next].time - elapsed, 0.0);
+
+		}
+
+
+		/*
+
+			Desc: Script Accessors.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Requested Value
+
+		*/
+		bool isDone() const { return this->next >= this->events.size(); }
+		size_t getEventCount() const { return this->events.size(); }
+
+};
\ No newline at end of file
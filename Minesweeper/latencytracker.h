@@ -0,0 +1,254 @@
+#pragma once
+
+
+
+#include <glad/glad.h>
+#include <chrono>
+#include <vector>
+#include "frameprofiler.h"
+#include "config.h"
+
+
+class LatencyTracker
+{
+
+	public:
+
+		// ~~~~~~ Points On A Click's Path Stamped Before It Is Presented ~~~~~~
+		enum Stage { INJECTED, UPDATED, UPLOADED, STAGE_COUNT };
+
+
+
+	private:
+
+		typedef std::chrono::steady_clock Clock;
+
+		static constexpr GLuint64 FENCE_TIMEOUT = 1000000000;	// Nanoseconds Before A Presentation Is Given Up On
+
+
+		// ~~~~~~ A Click In Flight, Stamped As It Passes Each Stage ~~~~~~
+		struct Click
+		{
+			Clock::time_point stamps[STAGE_COUNT];
+			bool stamped[STAGE_COUNT];
+		};
+
+		Click current = {};
+		bool isOpen = false;
+		bool isScripted = false;			// Input Is Being Replayed, Which Turns Tracking On
+		std::vector<Click> awaitingFrame;
+
+
+		LatencyTracker() = default;
+
+
+		// Milliseconds From click's Injection To time
+		static double since(const Click& click, Clock::time_point time)
+		{
+			return std::chrono::duration<double, std::milli>(time - click.stamps[INJECTED]).count();
+		}
+
+
+
+	public:
+
+		/*
+
+			Desc: Returns The Tracker For The Current Context. A Click Crosses
+			Scene, Board And Window, So Like FrameProfiler One Instance Follows
+			It Through All Of Them.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Shared Tracker
+
+		*/
+		static LatencyTracker& get()
+		{
+
+			static LatencyTracker tracker;
+			return tracker;
+
+		}
+
+
+		/*
+
+			Desc: Whether Clicks Are Tracked, Which Needs The Frame Profiler To
+			Hold The Results As Well As CONFIG::INPUT::MEASURE_LATENCY Or A
+			Scripted Run. Interactive Play Is Left Untracked By Default, As
+			Every Frame Answering A Click Would Otherwise Wait On A Fence.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns true If Clicks Will Be Stamped
+
+		*/
+		bool isEnabled() const
+		{
+
+			return CONFIG::PROFILER::ENABLED && (CONFIG::INPUT::MEASURE_LATENCY || this->isScripted);
+
+		}
+
+
+		/*
+
+			Desc: Marks Input As Coming From A Script (The Window's
+			CONFIG::INPUT::SCRIPT_PATH Or Render --script), Whose Clicks Are
+			Tracked Even With CONFIG::INPUT::MEASURE_LATENCY Off.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Clicks Begun From Now On Will Be Tracked If scripted
+				    And The Profiler Is Enabled
+
+		*/
+		void setScripted(bool scripted)
+		{
+
+			this->isScripted = scripted;
+
+		}
+
+
+		/*
+
+			Desc: Starts Tracking A Click As It Enters The Game, From GLFW Or
+			From An Input Script.
+
+			Preconditions:
+				1.) The Previous Click Must Have Been Ended
+
+			Postconditions:
+				1.) The Click's INJECTED Stage Will Be Stamped Now
+
+		*/
+		void begin()
+		{
+
+			if (!this->isEnabled())
+			{
+				return;
+			}
+
+			this->current = {};
+			this->current.stamps[INJECTED] = Clock::now();
+			this->current.stamped[INJECTED] = true;
+			this->isOpen = true;
+
+		}
+
+
+		/*
+
+			Desc: Stamps The Click Being Handled As Having Reached stage. Stages
+			Reached Outside A Tracked Click (Scripted Moves, Start Up) Are Ignored.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) stage Will Be Stamped Now If A Click Is Being Tracked
+
+		*/
+		void stamp(Stage stage)
+		{
+
+			if (this->isOpen)
+			{
+				this->current.stamps[stage] = Clock::now();
+				this->current.stamped[stage] = true;
+			}
+
+		}
+
+
+		/*
+
+			Desc: Ends Handling Of The Current Click. A Click That Changed The
+			Board Waits For The Frame That Shows It; One That Changed Nothing
+			Is Never Presented And Is Dropped.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) The Click Will Await presented If changed
+
+		*/
+		void end(bool changed)
+		{
+
+			if (this->isOpen && changed)
+			{
+				this->awaitingFrame.push_back(this->current);
+			}
+
+			this->isOpen = false;
+
+		}
+
+
+		/*
+
+			Desc: Called Once A Frame's Commands (And Buffer Swap) Have Been
+			Issued. If Clicks Await This Frame, A Fence Is Placed Behind It And
+			Waited On, So The Time Recorded Is When The GPU Finished The Frame
+			Showing Each Click Rather Than When The CPU Queued It; Scan-Out
+			Latency Of The Display Itself Is Not Included. Frames Without Clicks
+			Never Wait, So Only Frames Answering Input Lose Their Pipelining.
+
+			Preconditions:
+				1.) OpenGL Context Must Be Active
+
+			Postconditions:
+				1.) Each Awaiting Click's Update, Upload And Presentation Latency
+				    Will Be Recorded By The Frame Profiler
+				2.) No Click Will Be Awaiting A Frame
+
+		*/
+		void presented()
+		{
+
+			if (this->awaitingFrame.empty())
+			{
+				return;
+			}
+
+			GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			GLenum status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT);
+			Clock::time_point shown = Clock::now();
+			glDeleteSync(fence);
+
+			FrameProfiler& profiler = FrameProfiler::get();
+
+			for (const Click& click : this->awaitingFrame)
+			{
+				if (click.stamped[UPDATED])
+				{
+					profiler.record(FrameProfiler::INPUT_UPDATE, since(click, click.stamps[UPDATED]));
+				}
+
+				if (click.stamped[UPLOADED])
+				{
+					profiler.record(FrameProfiler::INPUT_UPLOAD, since(click, click.stamps[UPLOADED]));
+				}
+
+				if (status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED)
+				{
+					profiler.record(FrameProfiler::INPUT_PRESENT, since(click, shown));
+				}
+			}
+
+			this->awaitingFrame.clear();
+
+		}
+
+};
\ No newline at end of file
@@ -0,0 +1,364 @@
+#pragma once
+
+
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "engine.h"
+
+
+class LodPyramid
+{
+
+	public:
+
+		// ~~~~~~ Texel Layout (RGBA8, Each A Fraction Of The Texel's Area Scaled To 255) ~~~~~~
+		//   R : Revealed Safe Cells
+		//   G : Flagged Cells
+		//   B : Revealed Mines (Exploded)
+		//   A : Cells Inside The Board (Coverage)
+		static constexpr unsigned int CHANNELS = 4;
+
+
+		// ~~~~~~ Texel Rectangle [x0, x1) x [y0, y1) Changed Since The Last clearDirty ~~~~~~
+		struct Rect
+		{
+			unsigned int x0, y0, x1, y1;
+			bool empty() const { return x0 >= x1 || y0 >= y1; }
+		};
+
+
+	private:
+
+		// ~~~~~~ Board Shape ~~~~~~
+		unsigned int row_count = 0, col_count = 0;
+
+
+		// ~~~~~~ Pyramid Shape ~~~~~~
+		//   Level 0 Texels Cover 2^baseLevel Cells Per Side; Each Level Halves
+		//   The One Below, GL Mipmap Style, Down To 1x1. Level 0 Is Padded To
+		//   Powers Of Two So Every Parent Is The Plain Average Of Its Children.
+		unsigned int baseLevel = 0;
+		std::vector<unsigned int> widths, heights;
+		std::vector<std::vector<unsigned char>> levels;
+
+
+		// ~~~~~~ Incremental Updates ~~~~~~
+		std::vector<std::vector<unsigned int>> pending;		// Texels To Recompute, Per Level
+		std::vector<Rect> dirty;
+
+
+		/*
+
+			Desc: Recomputes One Level 0 Texel From The Cells It Covers. The
+			Texel Area Passes 32 Bits Once baseLevel Reaches 16 (A Long Single
+			Row Board), So The Counts And Fractions Are Taken In 64 Bits.
+
+			Preconditions:
+				1.) x And y Must Be A Level 0 Texel
+
+			Postconditions:
+				1.) The Texel Will Hold The Current Fractions For Its Cells
+
+		*/
+		void computeBase(const Engine& engine, unsigned int x, unsigned int y)
+		{
+
+			const unsigned int span = 1u << this->baseLevel;
+			const uint64_t area = static_cast<uint64_t>(span) * span;
+			uint64_t revealed = 0, flagged = 0, exploded = 0, inside = 0;
+
+			unsigned int rowEnd = std::min((y + 1) * span, this->row_count);
+			unsigned int colEnd = std::min((x + 1) * span, this->col_count);
+
+			for (unsigned int row = y * span; row < rowEnd; ++row)
+			{
+				for (unsigned int col = x * span; col < colEnd; ++col)
+				{
+					Engine::CellState state = engine.getState(row, col);
+
+					if (state == Engine::CellState::FLAGGED)
+					{
+						++flagged;
+					}
+					else if (state == Engine::CellState::REVEALED && engine.isMine(row, col))
+					{
+						++exploded;
+					}
+					else if (state == Engine::CellState::REVEALED)
+					{
+						++revealed;
+					}
+				}
+
+				inside += colEnd > x * span ? colEnd - x * span : 0;
+			}
+
+			unsigned char* texel = &this->levels[0][(static_cast<size_t>(y) * this->widths[0] + x) * CHANNELS];
+			texel[0] = static_cast<unsigned char>((revealed * 255 + area / 2) / area);
+			texel[1] = static_cast<unsigned char>((flagged * 255 + area / 2) / area);
+			texel[2] = static_cast<unsigned char>((exploded * 255 + area / 2) / area);
+			texel[3] = static_cast<unsigned char>((inside * 255 + area / 2) / area);
+
+		}
+
+
+		/*
+
+			Desc: Recomputes One Texel Above Level 0 As The Average Of Its (Up
+			To Four) Children. A Level That Has Already Reached Width Or Height
+			1 Only Has Two Children Per Texel.
+
+			Preconditions:
+				1.) level Must Be Above 0 And x, y A Texel Of It
+
+			Postconditions:
+				1.) The Texel Will Be The Box Filtered Level Below
+
+		*/
+		void computeParent(unsigned int level, unsigned int x, unsigned int y)
+		{
+
+			const std::vector<unsigned char>& below = this->levels[level - 1];
+			unsigned int belowWidth = this->widths[level - 1];
+			unsigned int x1 = std::min(2 * x + 2, belowWidth);
+			unsigned int y1 = std::min(2 * y + 2, this->heights[level - 1]);
+			unsigned int children = (x1 - 2 * x) * (y1 - 2 * y);
+
+			unsigned char* texel = &this->levels[level][(static_cast<size_t>(y) * this->widths[level] + x) * CHANNELS];
+
+			for (unsigned int channel = 0; channel < CHANNELS; ++channel)
+			{
+				unsigned int sum = 0;
+
+				for (unsigned int cy = 2 * y; cy < y1; ++cy)
+				{
+					for (unsigned int cx = 2 * x; cx < x1; ++cx)
+					{
+						sum += below[(static_cast<size_t>(cy) * belowWidth + cx) * CHANNELS + channel];
+					}
+				}
+
+				texel[channel] = static_cast<unsigned char>((sum + children / 2) / children);
+			}
+
+		}
+
+
+		/*
+
+			Desc: Grows A Level's Dirty Rectangle To Include Texel (x, y).
+
+			Preconditions:
+				1.) level Must Be Valid
+
+			Postconditions:
+				1.) dirty[level] Will Contain The Texel
+
+		*/
+		void touch(unsigned int level, unsigned int x, unsigned int y)
+		{
+
+			Rect& rect = this->dirty[level];
+
+			rect.x0 = std::min(rect.x0, x);
+			rect.y0 = std::min(rect.y0, y);
+			rect.x1 = std::max(rect.x1, x + 1);
+			rect.y1 = std::max(rect.y1, y + 1);
+
+		}
+
+
+
+	public:
+
+		/*
+
+			Desc: Builds Every Level From The Engine's Current Cells. The Base
+			Level Is The Finest Whose Padded Size Fits maxSide Texels, So The
+			Pyramid Stays Small (At Most 4/3 * maxSide^2 Texels) Even On 10^8+
+			Cell Boards.
+
+			Preconditions:
+				1.) engine Must Be Initialized
+				2.) maxSide Must Be A Power Of Two
+
+			Postconditions:
+				1.) Every Level Will Be Current And Marked Dirty In Full
+
+		*/
+		void build(const Engine& engine, unsigned int maxSide)
+		{
+
+			this->row_count = engine.getRowCount();
+			this->col_count = engine.getColCount();
+
+			unsigned int paddedCols = 1, paddedRows = 1;
+			while (paddedCols < this->col_count) paddedCols <<= 1;
+			while (paddedRows < this->row_count) paddedRows <<= 1;
+
+			this->baseLevel = 0;
+			while ((paddedCols >> this->baseLevel) > maxSide || (paddedRows >> this->baseLevel) > maxSide)
+			{
+				++this->baseLevel;
+			}
+
+			this->widths.clear();
+			this->heights.clear();
+			this->levels.clear();
+
+			unsigned int width = std::max(paddedCols >> this->baseLevel, 1u);
+			unsigned int height = std::max(paddedRows >> this->baseLevel, 1u);
+
+			while (true)
+			{
+				this->widths.push_back(width);
+				this->heights.push_back(height);
+				this->levels.emplace_back(static_cast<size_t>(width) * height * CHANNELS, 0);
+
+				if (width == 1 && height == 1)
+				{
+					break;
+				}
+
+				width = std::max(width / 2, 1u);
+				height = std::max(height / 2, 1u);
+			}
+
+			this->pending.assign(this->levels.size(), std::vector<unsigned int>());
+			this->dirty.assign(this->levels.size(), Rect{ 0, 0, 0, 0 });
+
+			for (unsigned int level = 0; level < this->levels.size(); ++level)
+			{
+				for (unsigned int y = 0; y < this->heights[level]; ++y)
+				{
+					for (unsigned int x = 0; x < this->widths[level]; ++x)
+					{
+						if (level == 0) this->computeBase(engine, x, y);
+						else this->computeParent(level, x, y);
+					}
+				}
+
+				this->dirty[level] = Rect{ 0, 0, this->widths[level], this->heights[level] };
+			}
+
+		}
+
+
+		/*
+
+			Desc: Queues The Level 0 Texel Holding A Changed Cell. Nothing Is
+			Recomputed Until refresh, So A Flood Fill Touching Many Cells Of
+			One Texel Costs One Recompute.
+
+			Preconditions:
+				1.) build Must Have Been Called
+				2.) row And col Must Be A Valid Cell
+
+			Postconditions:
+				1.) The Cell's Texel Will Be Recomputed By The Next refresh
+
+		*/
+		void markCell(unsigned int row, unsigned int col)
+		{
+
+			this->pending[0].push_back((row >> this->baseLevel) * this->widths[0] + (col >> this->baseLevel));
+
+		}
+
+
+		/*
+
+			Desc: Recomputes Every Queued Texel, Then Their Ancestors Level By
+			Level, So A Change Costs O(log) Texels Instead Of A Rebuild.
+
+			Preconditions:
+				1.) engine Must Be The Engine The Pyramid Was Built From
+
+			Postconditions:
+				1.) Every Level Will Match The Engine's Cells
+				2.) dirty Will Cover Every Texel That Changed
+
+		*/
+		void refresh(const Engine& engine)
+		{
+
+			for (unsigned int level = 0; level < this->levels.size(); ++level)
+			{
+				std::vector<unsigned int>& queue = this->pending[level];
+
+				if (queue.empty())
+				{
+					break;
+				}
+
+				std::sort(queue.begin(), queue.end());
+				queue.erase(std::unique(queue.begin(), queue.end()), queue.end());
+
+				for (unsigned int index : queue)
+				{
+					unsigned int x = index % this->widths[level];
+					unsigned int y = index / this->widths[level];
+
+					if (level == 0) this->computeBase(engine, x, y);
+					else this->computeParent(level, x, y);
+
+					this->touch(level, x, y);
+
+					if (level + 1 < this->levels.size())
+					{
+						this->pending[level + 1].push_back((y / 2) * this->widths[level + 1] + x / 2);
+					}
+				}
+
+				queue.clear();
+			}
+
+		}
+
+
+		/*
+
+			Desc: Pyramid Accessors. Level i Is getWidth(i) x getHeight(i)
+			Texels Of CHANNELS Bytes, Row-Major, Each Covering
+			2^(getBaseLevel() + i) Cells Per Side.
+
+			Preconditions:
+				1.) build Must Have Been Called
+				2.) level Must Be Less Than getLevelCount()
+
+			Postconditions:
+				1.) Returns The Requested Value
+
+		*/
+		unsigned int getBaseLevel() const { return this->baseLevel; }
+		unsigned int getLevelCount() const { return static_cast<unsigned int>(this->levels.size()); }
+		unsigned int getWidth(unsigned int level) const { return this->widths[level]; }
+		unsigned int getHeight(unsigned int level) const { return this->heights[level]; }
+		const unsigned char* getLevel(unsigned int level) const { return this->levels[level].data(); }
+		const Rect& getDirty(unsigned int level) const { return this->dirty[level]; }
+
+
+		/*
+
+			Desc: Forgets The Dirty Rectangles Once They Have Been Consumed.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Every Level's Dirty Rectangle Will Be Empty
+
+		*/
+		void clearDirty()
+		{
+
+			for (Rect& rect : this->dirty)
+			{
+				rect = Rect{ ~0u, ~0u, 0, 0 };
+			}
+
+		}
+
+};
\ No newline at end of file
@@ -0,0 +1,409 @@
+#pragma once
+
+
+
+#include <glad/glad.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include "config.h"
+#include "png.h"
+#include "programcache.h"
+
+
+class Offscreen
+{
+
+	private:
+
+		// ~~~~~~ EGL Context (No Window System Or Display Needed) ~~~~~~
+		EGLDisplay display = EGL_NO_DISPLAY;
+		EGLContext context = EGL_NO_CONTEXT;
+		bool isInit = false;
+
+
+		// ~~~~~~ Render Target ~~~~~~
+		unsigned int width, height;
+		GLuint framebuffer = 0, colorBuffer = 0;
+
+
+		// ~~~~~~ Asynchronous Readback Ring ~~~~~~
+		//   capture Queues glReadPixels Into A Pixel Buffer Object And Returns
+		//   At Once; The Pixels Are Mapped And Encoded Only When The Slot Is
+		//   Needed Again (Or On flush), So The GPU Keeps Rendering Meanwhile.
+		GLuint pixelBuffers[CONFIG::OFFSCREEN::READBACK_SLOTS] = {};
+		GLsync fences[CONFIG::OFFSCREEN::READBACK_SLOTS] = {};
+		std::string paths[CONFIG::OFFSCREEN::READBACK_SLOTS];
+		unsigned int nextSlot = 0, pendingCount = 0;
+		unsigned int framesWritten = 0;
+
+
+		/*
+
+			Desc: Opens An EGL Display Without A Window System, Preferring Mesa's
+			Surfaceless Platform (Which Also Runs On llvmpipe With No GPU) And
+			Falling Back To The Default Display.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) display Will Be Initialized, Or Returns false
+
+		*/
+		bool openDisplay()
+		{
+
+			const char* extensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+			PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+				reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+
+			if (extensions && std::strstr(extensions, "EGL_MESA_platform_surfaceless") && getPlatformDisplay)
+			{
+				this->display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+			}
+
+			if (this->display == EGL_NO_DISPLAY)
+			{
+				this->display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+			}
+
+			EGLint major = 0, minor = 0;
+			return this->display != EGL_NO_DISPLAY && eglInitialize(this->display, &major, &minor);
+
+		}
+
+
+		/*
+
+			Desc: Creates The RGBA8 Framebuffer Object The Scene Renders Into,
+			Plus The Readback Pixel Buffers.
+
+			Preconditions:
+				1.) The Context Must Be Current With GLAD Loaded
+
+			Postconditions:
+				1.) framebuffer Will Be Complete And Bound For Drawing And Reading
+				2.) Returns false If The Driver Rejected It
+
+		*/
+		bool createTarget()
+		{
+
+			glGenRenderbuffers(1, &this->colorBuffer);
+			glBindRenderbuffer(GL_RENDERBUFFER, this->colorBuffer);
+			glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, this->width, this->height);
+
+			glGenFramebuffers(1, &this->framebuffer);
+			glBindFramebuffer(GL_FRAMEBUFFER, this->framebuffer);
+			glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, this->colorBuffer);
+
+			if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+			{
+				std::cerr << "Offscreen Framebuffer Is Incomplete...\n";
+				return false;
+			}
+
+			glGenBuffers(CONFIG::OFFSCREEN::READBACK_SLOTS, this->pixelBuffers);
+
+			for (GLuint buffer : this->pixelBuffers)
+			{
+				glBindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+				glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(this->width) * this->height * 4, nullptr, GL_STREAM_READ);
+			}
+
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+			return true;
+
+		}
+
+
+		/*
+
+			Desc: Waits For The Oldest Queued Readback, Then Maps Its Pixel
+			Buffer And Encodes It To Its PNG Path.
+
+			Preconditions:
+				1.) pendingCount Must Be Above 0
+
+			Postconditions:
+				1.) The Oldest Capture Will Be Written And Its Slot Freed
+
+		*/
+		void finishOldest()
+		{
+
+			unsigned int slot = (this->nextSlot + CONFIG::OFFSCREEN::READBACK_SLOTS - this->pendingCount) % CONFIG::OFFSCREEN::READBACK_SLOTS;
+
+			glClientWaitSync(this->fences[slot], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+			glDeleteSync(this->fences[slot]);
+			this->fences[slot] = nullptr;
+
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, this->pixelBuffers[slot]);
+			const unsigned char* pixels = static_cast<const unsigned char*>(
+				glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(this->width) * this->height * 4, GL_MAP_READ_BIT));
+
+			if (!pixels || !PngWriter::write(this->paths[slot], this->width, this->height, pixels, true))
+			{
+				std::cerr << "Failed To Write Frame: " << this->paths[slot] << "\n";
+			}
+			else
+			{
+				++this->framesWritten;
+			}
+
+			if (pixels)
+			{
+				glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+			}
+
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			--this->pendingCount;
+
+		}
+
+
+
+	public:
+
+		/*
+
+			Desc: Constructs An Offscreen Target Of The Given Size. Nothing Is
+			Created Until initialize.
+
+			Preconditions:
+				1.) width And height Must Be Positive
+
+			Postconditions:
+				1.) The Target Will Be Ready For initialize() Call
+
+		*/
+		Offscreen(unsigned int width = CONFIG::WINDOW::WIDTH, unsigned int height = CONFIG::WINDOW::HEIGHT) :
+			width(width), height(height)
+		{
+		}
+
+
+		/*
+
+			Desc: Creates A GL 3.3 Core Context Through EGL With No Surface,
+			Loads GLAD (And The Program Cache's Entry Points) From It And Binds
+			A Framebuffer Object Of The Target Size, So The Same Scene The
+			Window Draws Can Be Rendered On A Server.
+
+			Preconditions:
+				1.) An EGL Implementation (Such As Mesa) Must Be Installed
+
+			Postconditions:
+				1.) The Context Will Be Current And The Offscreen Framebuffer Bound
+				2.) Returns false, Having Reported Why, If Any Step Failed
+
+		*/
+		bool initialize()
+		{
+
+			if (this->isInit)
+			{
+				std::cerr << "Offscreen Target Has Already Been Initialized...\n";
+				return false;
+			}
+
+			if (!this->openDisplay())
+			{
+				std::cerr << "EGL Display Initialization Has Failed...\n";
+				return false;
+			}
+
+			const EGLint configAttributes[] = {
+				EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+				EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+				EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8,
+				EGL_NONE
+			};
+			const EGLint contextAttributes[] = {
+				EGL_CONTEXT_MAJOR_VERSION, 3,
+				EGL_CONTEXT_MINOR_VERSION, 3,
+				EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+				EGL_NONE
+			};
+
+			EGLConfig config;
+			EGLint configCount = 0;
+
+			if (!eglChooseConfig(this->display, configAttributes, &config, 1, &configCount) || configCount < 1 || !eglBindAPI(EGL_OPENGL_API))
+			{
+				std::cerr << "No EGL Config Supports Desktop OpenGL...\n";
+				return false;
+			}
+
+			this->context = eglCreateContext(this->display, config, EGL_NO_CONTEXT, contextAttributes);
+
+			// Rendering Goes To Our Own Framebuffer, So No Surface Is Bound
+			if (this->context == EGL_NO_CONTEXT || !eglMakeCurrent(this->display, EGL_NO_SURFACE, EGL_NO_SURFACE, this->context))
+			{
+				std::cerr << "EGL Context Creation Has Failed...\n";
+				return false;
+			}
+
+			if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+			{
+				std::cerr << "GLAD Initialization Has Failed...\n";
+				return false;
+			}
+
+			ProgramCache::get().initialize((GLADloadproc)eglGetProcAddress);
+
+			if (!this->createTarget())
+			{
+				return false;
+			}
+
+			this->isInit = true;
+
+			return true;
+
+		}
+
+
+		/*
+
+			Desc: Queues A Readback Of The Current Frame, To Be Written As A PNG
+			At path. Returns Without Waiting For The GPU Unless Every Slot Is
+			Already In Flight, In Which Case The Oldest Is Written First.
+
+			Preconditions:
+				1.) Offscreen Target Must Be Initialized
+				2.) The Frame Must Have Been Drawn Into The Bound Framebuffer
+
+			Postconditions:
+				1.) The Frame Will Be Written To path By A Later capture Or flush
+
+		*/
+		void capture(const std::string& path)
+		{
+
+			if (this->pendingCount == CONFIG::OFFSCREEN::READBACK_SLOTS)
+			{
+				this->finishOldest();
+			}
+
+			unsigned int slot = this->nextSlot;
+
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, this->pixelBuffers[slot]);
+			glReadPixels(0, 0, this->width, this->height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+			this->fences[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			this->paths[slot] = path;
+			this->nextSlot = (slot + 1) % CONFIG::OFFSCREEN::READBACK_SLOTS;
+			++this->pendingCount;
+
+		}
+
+
+		/*
+
+			Desc: Writes Every Capture Still In Flight.
+
+			Preconditions:
+				1.) Offscreen Target Must Be Initialized
+
+			Postconditions:
+				1.) Every Queued Frame Will Be On Disk
+
+		*/
+		void flush()
+		{
+
+			while (this->pendingCount > 0)
+			{
+				this->finishOldest();
+			}
+
+		}
+
+
+		/*
+
+			Desc: Writes Outstanding Captures And Releases The Framebuffer,
+			Pixel Buffers And EGL Context.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) All Offscreen Resources Will Be Released
+				2.) isInit Flag Will Be Set To false
+
+		*/
+		void terminate()
+		{
+
+			if (this->isInit)
+			{
+				this->flush();
+
+				glDeleteBuffers(CONFIG::OFFSCREEN::READBACK_SLOTS, this->pixelBuffers);
+				glDeleteFramebuffers(1, &this->framebuffer);
+				glDeleteRenderbuffers(1, &this->colorBuffer);
+			}
+
+			if (this->display != EGL_NO_DISPLAY)
+			{
+				eglMakeCurrent(this->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+
+				if (this->context != EGL_NO_CONTEXT)
+				{
+					eglDestroyContext(this->display, this->context);
+				}
+
+				eglTerminate(this->display);
+			}
+
+			this->display = EGL_NO_DISPLAY;
+			this->context = EGL_NO_CONTEXT;
+			this->isInit = false;
+
+		}
+
+
+		/*
+
+			Desc: Destructor Ensuring Captures Are Written And Resources Released.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) terminate() Will Have Run
+
+		*/
+		~Offscreen()
+		{
+
+			this->terminate();
+
+		}
+
+
+		/*
+
+			Desc: Target Accessors. getFramesWritten Counts PNGs Successfully
+			Written So Far.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Requested Value
+
+		*/
+		unsigned int getWidth() const { return this->width; }
+		unsigned int getHeight() const { return this->height; }
+		unsigned int getFramesWritten() const { return this->framesWritten; }
+
+};
\ No newline at end of file
@@ -0,0 +1,310 @@
+#pragma once
+
+
+
+#include <cstdint>
+#include <vector>
+
+
+class OpeningIndex
+{
+
+	public:
+
+		// ~~~~~~ Label Of Cells Outside Any Opening ~~~~~~
+		static constexpr unsigned int NONE = 0xFFFFFFFFu;
+
+
+	private:
+
+		// ~~~~~~ Build State ~~~~~~
+		bool built = false;
+
+
+		// ~~~~~~ Opening Label Of Every Cell (NONE Unless It Has No Adjacent Mines) ~~~~~~
+		std::vector<unsigned int> labels;
+
+
+		// ~~~~~~ Cells Of Each Opening Stored Contiguously ~~~~~~
+		//   Opening k Owns cellList[regionStart[k] .. regionStart[k + 1])
+		std::vector<unsigned int> regionStart;
+		std::vector<unsigned int> cellList;
+
+
+		// ~~~~~~ Openings That Had A Zero Cell Flagged This Game ~~~~~~
+		std::vector<unsigned char> flagged;
+
+
+		/*
+
+			Desc: Union-Find Root Lookup With Path Halving. Parents Always Point
+			At A Smaller Index, So Every Root Is The First Cell Of Its Set.
+
+			Preconditions:
+				1.) index Must Be Part Of A Set
+
+			Postconditions:
+				1.) Returns The Root Of index's Set
+
+		*/
+		unsigned int findRoot(unsigned int index)
+		{
+
+			while (this->labels[index] != index)
+			{
+				this->labels[index] = this->labels[this->labels[index]];
+				index = this->labels[index];
+			}
+
+			return index;
+
+		}
+
+		void unite(unsigned int a, unsigned int b)
+		{
+
+			a = this->findRoot(a);
+			b = this->findRoot(b);
+
+			if (a < b) this->labels[b] = a;
+			else if (b < a) this->labels[a] = b;
+
+		}
+
+
+		/*
+
+			Desc: Collects The Distinct Openings Touching A Numbered Cell. A Cell
+			Can Border At Most Four Separate Openings.
+
+			Preconditions:
+				1.) labels Must Hold Final Opening Ids
+
+			Postconditions:
+				1.) out[0 .. Return Value) Will Hold Distinct Opening Ids
+
+		*/
+		unsigned int neighbourRegions(unsigned int row, unsigned int col, unsigned int rows, unsigned int cols, unsigned int out[8]) const
+		{
+
+			unsigned int found = 0;
+
+			for (int dr = -1; dr <= 1; ++dr)
+			{
+				for (int dc = -1; dc <= 1; ++dc)
+				{
+					int nr = static_cast<int>(row) + dr;
+					int nc = static_cast<int>(col) + dc;
+
+					if ((dr == 0 && dc == 0) || nr < 0 || nc < 0 || nr >= static_cast<int>(rows) || nc >= static_cast<int>(cols))
+					{
+						continue;
+					}
+
+					unsigned int region = this->labels[static_cast<unsigned int>(nr) * cols + nc];
+
+					if (region == NONE)
+					{
+						continue;
+					}
+
+					bool seen = false;
+
+					for (unsigned int i = 0; i < found; ++i)
+					{
+						seen = seen || out[i] == region;
+					}
+
+					if (!seen)
+					{
+						out[found++] = region;
+					}
+				}
+			}
+
+			return found;
+
+		}
+
+
+
+	public:
+
+		/*
+
+			Desc: Labels Every Connected Region Of Zero Cells (8-Connected) With
+			Union-Find And Stores Each Region's Cells Plus Its Numbered Border
+			Contiguously. A Border Cell Shared By Several Openings Is Listed In
+			Each Of Them. Openings Are Numbered In Row-Major Order Of Their First
+			Cell And Each List Is Row-Major.
+
+			Preconditions:
+				1.) cells Must Hold rows * cols Freshly Generated Bytes
+
+			Postconditions:
+				1.) Every Zero Cell Will Carry Its Opening Id, All Others NONE
+				2.) Each Opening's Cell List And Size Will Be Available
+				3.) No Opening Will Be Marked As Flagged
+
+		*/
+		void build(const unsigned char* cells, unsigned int rows, unsigned int cols, unsigned char countMask, unsigned char mineBit)
+		{
+
+			unsigned int cellCount = rows * cols;
+			unsigned char valueMask = countMask | mineBit;
+
+			this->labels.assign(cellCount, static_cast<unsigned int>(NONE));
+
+			// Pass 1: Union Each Zero Cell With Its Already Scanned Zero Neighbours (W, NW, N, NE)
+			for (unsigned int r = 0; r < rows; ++r)
+			{
+				for (unsigned int c = 0; c < cols; ++c)
+				{
+					unsigned int index = r * cols + c;
+
+					if (cells[index] & valueMask)
+					{
+						continue;
+					}
+
+					this->labels[index] = index;
+
+					if (c > 0 && this->labels[index - 1] != NONE) this->unite(index, index - 1);
+
+					if (r > 0)
+					{
+						unsigned int up = index - cols;
+
+						if (c > 0 && this->labels[up - 1] != NONE) this->unite(index, up - 1);
+						if (this->labels[up] != NONE) this->unite(index, up);
+						if (c + 1 < cols && this->labels[up + 1] != NONE) this->unite(index, up + 1);
+					}
+				}
+			}
+
+			// Pass 2: Replace Parents With Compact Ids; A Parent Is Always Already Relabelled
+			unsigned int regionCount = 0;
+
+			for (unsigned int index = 0; index < cellCount; ++index)
+			{
+				unsigned int parent = this->labels[index];
+
+				if (parent != NONE)
+				{
+					this->labels[index] = parent == index ? regionCount++ : this->labels[parent];
+				}
+			}
+
+			// Pass 3: Count Then Fill Each Opening's Cells And Border
+			this->regionStart.assign(regionCount + 1, 0);
+			unsigned int touching[8];
+
+			for (unsigned int index = 0; index < cellCount; ++index)
+			{
+				if (this->labels[index] != NONE)
+				{
+					++this->regionStart[this->labels[index] + 1];
+				}
+				else if (!(cells[index] & mineBit))
+				{
+					unsigned int found = this->neighbourRegions(index / cols, index % cols, rows, cols, touching);
+
+					for (unsigned int i = 0; i < found; ++i)
+					{
+						++this->regionStart[touching[i] + 1];
+					}
+				}
+			}
+
+			for (unsigned int region = 0; region < regionCount; ++region)
+			{
+				this->regionStart[region + 1] += this->regionStart[region];
+			}
+
+			std::vector<unsigned int> cursor(this->regionStart.begin(), this->regionStart.end() - 1);
+			this->cellList.resize(this->regionStart[regionCount]);
+
+			for (unsigned int index = 0; index < cellCount; ++index)
+			{
+				if (this->labels[index] != NONE)
+				{
+					this->cellList[cursor[this->labels[index]]++] = index;
+				}
+				else if (!(cells[index] & mineBit))
+				{
+					unsigned int found = this->neighbourRegions(index / cols, index % cols, rows, cols, touching);
+
+					for (unsigned int i = 0; i < found; ++i)
+					{
+						this->cellList[cursor[touching[i]]++] = index;
+					}
+				}
+			}
+
+			this->flagged.assign(regionCount, 0);
+			this->built = true;
+
+		}
+
+
+		/*
+
+			Desc: Drops All Labels And Lists, Releasing Their Memory.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) isBuilt() Will Return false
+
+		*/
+		void clear()
+		{
+
+			std::vector<unsigned int>().swap(this->labels);
+			std::vector<unsigned int>().swap(this->regionStart);
+			std::vector<unsigned int>().swap(this->cellList);
+			std::vector<unsigned char>().swap(this->flagged);
+			this->built = false;
+
+		}
+
+
+		/*
+
+			Desc: Marks An Opening Whose Zero Cell Was Flagged. A Flag Inside An
+			Opening Splits It For The Flood Fill, And Parts Revealed Around It
+			Stay Split After It Is Removed, So A Marked Opening Is Left To The
+			Flood Fill Until The Next build().
+
+			Preconditions:
+				1.) region Must Be A Valid Opening Id
+
+			Postconditions:
+				1.) isFlagged(region) Will Return true
+
+		*/
+		void markFlagged(unsigned int region) { this->flagged[region] = 1; }
+
+
+		/*
+
+			Desc: Query Accessors For The Labels And Per-Opening Data.
+
+			Preconditions:
+				1.) build() Must Have Been Called
+				2.) region Must Be A Valid Opening Id
+
+			Postconditions:
+				1.) Returns The Requested Value Without Modifying The Index
+
+		*/
+		bool isBuilt() const { return this->built; }
+		unsigned int getRegion(unsigned int index) const { return this->labels[index]; }
+		unsigned int getRegionCount() const { return static_cast<unsigned int>(this->flagged.size()); }
+		unsigned int getRegionSize(unsigned int region) const { return this->regionStart[region + 1] - this->regionStart[region]; }
+		bool isFlagged(unsigned int region) const { return this->flagged[region] != 0; }
+		const unsigned int* regionBegin(unsigned int region) const { return this->cellList.data() + this->regionStart[region]; }
+		const unsigned int* regionEnd(unsigned int region) const { return this->cellList.data() + this->regionStart[region + 1]; }
+
+};
@@ -0,0 +1,245 @@
+#pragma once
+
+
+
+#include <glad/glad.h>
+#include <vector>
+#include "frameprofiler.h"
+#include "glstate.h"
+#include "shader.h"
+#include "config.h"
+#include "vertex.h"
+
+
+class Overlay
+{
+
+	private:
+
+		// ~~~~~~ Layout In Glyph Cells: A Timer Swatch, Then p50, p99 And Max In Microseconds ~~~~~~
+		static constexpr unsigned int VALUE_DIGITS = 6;
+		static constexpr unsigned int COLUMNS = 2 + 3 * (VALUE_DIGITS + 1);
+		static constexpr unsigned int ROWS = FrameProfiler::TIMER_COUNT;
+		static constexpr unsigned int MARGIN = 8;			// Pixels From The Top Left Corner
+
+
+		// ~~~~~~ One Instance Per Glyph Cell, Position Its Bottom Left Corner In Unit Screen Coordinates ~~~~~~
+		GLuint VAO = 0, VBO = 0;
+		std::vector<Vertex> glyphs;
+		unsigned int viewWidth = 1, viewHeight = 1;
+
+
+		/*
+
+			Desc: Appends One Glyph Cell At column, row Of The Overlay Grid.
+
+			Preconditions:
+				1.) glyph Must Be An Atlas Slot Or Vertex::NO_GLYPH (A Solid Tile)
+
+			Postconditions:
+				1.) The Cell Will Be Drawn After Every Cell Added Before It
+
+		*/
+		void addGlyph(unsigned int column, unsigned int row, const unsigned char (&color)[3], unsigned char glyph)
+		{
+
+			float x = static_cast<float>(MARGIN + column * CONFIG::SHADER::TEXT_ATLAS::CHAR_WIDTH) / this->viewWidth;
+			float y = 1.0f - static_cast<float>(MARGIN + (row + 1) * CONFIG::SHADER::TEXT_ATLAS::CHAR_HEIGHT) / this->viewHeight;
+
+			Vertex vertex = { { toUnorm16(x), toUnorm16(y) }, { color[0], color[1], color[2] }, glyph };
+			this->glyphs.push_back(vertex);
+
+		}
+
+
+		/*
+
+			Desc: Appends milliseconds As Whole Microseconds, Right Aligned In
+			VALUE_DIGITS Cells Ending Before column.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Values Too Wide Are Clamped To All Nines
+
+		*/
+		void addValue(unsigned int column, unsigned int row, const unsigned char (&color)[3], double milliseconds)
+		{
+
+			unsigned long long limit = 1;
+
+			for (unsigned int i = 0; i < VALUE_DIGITS; ++i)
+			{
+				limit *= 10;
+			}
+
+			unsigned long long micros = static_cast<unsigned long long>(milliseconds * 1000.0 + 0.5);
+			micros = micros < limit ? micros : limit - 1;
+
+			do
+			{
+				this->addGlyph(--column, row, color, static_cast<unsigned char>(micros % 10));
+				micros /= 10;
+			} while (micros > 0);
+
+		}
+
+
+		// Maps A [0, 1] Coordinate To Its Normalized Unsigned Short, Clamped To The Screen
+		static unsigned short toUnorm16(float value)
+		{
+
+			value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+			return static_cast<unsigned short>(value * 65535.0f + 0.5f);
+
+		}
+
+
+
+	public:
+
+		/*
+
+			Desc: Creates The Overlay's VAO, Whose Vertex Attributes Advance Once
+			Per Instance So Each Vertex Is A Whole Glyph Quad.
+
+			Preconditions:
+				1.) OpenGL Context Must Be Active
+
+			Postconditions:
+				1.) The Overlay Will Be Ready To Render
+
+		*/
+		void initialize()
+		{
+
+			glGenVertexArrays(1, &this->VAO);
+			glGenBuffers(1, &this->VBO);
+
+			GLState::get().bindVertexArray(this->VAO);
+			GLState::get().bindArrayBuffer(this->VBO);
+
+			glVertexAttribPointer(0, 2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+			glVertexAttribPointer(1, 3, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+			glVertexAttribIPointer(2, 1, GL_UNSIGNED_BYTE, sizeof(Vertex), (void*)offsetof(Vertex, glyph));
+
+			for (GLuint attribute = 0; attribute < 3; ++attribute)
+			{
+				glEnableVertexAttribArray(attribute);
+				glVertexAttribDivisor(attribute, 1);
+			}
+
+		}
+
+
+		/*
+
+			Desc: Tells The Overlay The Framebuffer Size, As Glyphs Are Laid Out
+			In Pixels So They Stay One Atlas Texel Per Pixel.
+
+			Preconditions:
+				1.) width And height Must Be The Current Viewport Size
+
+			Postconditions:
+				1.) The Next render Will Lay Glyphs Out For The New Size
+
+		*/
+		void setViewport(unsigned int width, unsigned int height)
+		{
+
+			this->viewWidth = width > 0 ? width : 1;
+			this->viewHeight = height > 0 ? height : 1;
+
+		}
+
+
+		/*
+
+			Desc: Draws The Profiler's Rolling Percentiles In The Top Left
+			Corner With The Digit Glyphs Of The Procedural Atlas: A Dark Panel,
+			Then One Row Per Timer Of A Coloured Swatch Naming The Timer
+			Followed By p50 (White), p99 (Yellow) And Max (Red) In
+			Microseconds. Timers Without Samples Show Only Their Swatch.
+
+			Preconditions:
+				1.) shader Must Be The Active Program
+				2.) The Board Must Have Been Rendered, Binding The Atlas To Unit 0
+				    And Setting atlasSlot
+
+			Postconditions:
+				1.) The Overlay Will Be Drawn Over The Frame In One Instanced Draw
+				2.) The cellMode Uniform Will Be Restored To 0
+
+		*/
+		void render(const Shader& shader)
+		{
+
+			static const unsigned char panel[3] = { 20, 20, 20 };
+			static const unsigned char swatches[ROWS][3] = {
+				{ 70, 130, 255 }, { 0, 220, 220 }, { 80, 220, 80 }, { 255, 150, 40 }, { 230, 80, 230 },
+				{ 150, 110, 60 }, { 160, 120, 255 }, { 240, 240, 240 }
+			};
+			static const unsigned char columns[3][3] = { { 255, 255, 255 }, { 255, 230, 0 }, { 255, 60, 60 } };
+
+			FrameProfiler& profiler = FrameProfiler::get();
+			this->glyphs.clear();
+
+			for (unsigned int row = 0; row < ROWS; ++row)
+			{
+				for (unsigned int column = 0; column < COLUMNS; ++column)
+				{
+					this->addGlyph(column, row, panel, Vertex::NO_GLYPH);
+				}
+			}
+
+			for (unsigned int row = 0; row < ROWS; ++row)
+			{
+				FrameProfiler::Percentiles stats = profiler.getPercentiles(static_cast<FrameProfiler::Timer>(row));
+				this->addGlyph(0, row, swatches[row], Vertex::NO_GLYPH);
+
+				if (stats.samples > 0)
+				{
+					this->addValue(2 + VALUE_DIGITS, row, columns[0], stats.p50);
+					this->addValue(3 + 2 * VALUE_DIGITS, row, columns[1], stats.p99);
+					this->addValue(4 + 3 * VALUE_DIGITS, row, columns[2], stats.max);
+				}
+			}
+
+			GLState& gl = GLState::get();
+
+			gl.bindVertexArray(this->VAO);
+			gl.bindArrayBuffer(this->VBO);
+			gl.call(glBufferData, GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(this->glyphs.size() * sizeof(Vertex)), this->glyphs.data(), GL_STREAM_DRAW);
+
+			gl.call(glUniform1i, shader.getUniform("cellMode"), 5);
+			gl.call(glUniform2f, shader.getUniform("glyphSize"),
+				static_cast<float>(CONFIG::SHADER::TEXT_ATLAS::CHAR_WIDTH) / this->viewWidth,
+				static_cast<float>(CONFIG::SHADER::TEXT_ATLAS::CHAR_HEIGHT) / this->viewHeight);
+			gl.call(glDrawArraysInstanced, GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(this->glyphs.size()));
+			gl.call(glUniform1i, shader.getUniform("cellMode"), 0);
+
+		}
+
+
+		/*
+
+			Desc: Deletes The Overlay's GL Objects.
+
+			Preconditions:
+				1.) The Context The Overlay Was Initialized In Must Be Current
+
+			Postconditions:
+				1.) The Overlay Must Be Initialized Again Before Rendering
+
+		*/
+		void terminate()
+		{
+
+			glDeleteVertexArrays(1, &this->VAO);
+			glDeleteBuffers(1, &this->VBO);
+			this->VAO = this->VBO = 0;
+
+		}
+
+};
\ No newline at end of file
@@ -0,0 +1,232 @@
+#pragma once
+
+
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+class Xoshiro256
+{
+
+	private:
+
+		// ~~~~~~ Generator State ~~~~~~
+		uint64_t state[4];
+
+
+		static uint64_t rotl(uint64_t x, int k)
+		{
+
+			return (x << k) | (x >> (64 - k));
+
+		}
+
+
+
+	public:
+
+		/*
+
+			Desc: Advances A SplitMix64 Counter And Returns Its Mixed Output.
+			Used To Expand A Single 64-Bit Seed Into Full Generator State.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) x Will Be Advanced, The Mixed Value Is Returned
+
+		*/
+		static uint64_t splitMix64(uint64_t& x)
+		{
+
+			uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+			z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+			return z ^ (z >> 31);
+
+		}
+
+
+		/*
+
+			Desc: Seeds The Generator (xoshiro256**) From A 64-Bit Seed. The
+			Output Sequence Depends Only On The Seed, Never On The Platform
+			Or Standard Library.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Generator Will Be Ready To Produce Values
+
+		*/
+		explicit Xoshiro256(uint64_t seed)
+		{
+
+			for (int i = 0; i < 4; ++i)
+			{
+				this->state[i] = splitMix64(seed);
+			}
+
+		}
+
+
+		/*
+
+			Desc: Returns The Next 64 Random Bits.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Generator State Will Be Advanced
+
+		*/
+		uint64_t next()
+		{
+
+			uint64_t result = rotl(this->state[1] * 5, 7) * 9;
+			uint64_t t = this->state[1] << 17;
+
+			this->state[2] ^= this->state[0];
+			this->state[3] ^= this->state[1];
+			this->state[1] ^= this->state[2];
+			this->state[0] ^= this->state[3];
+			this->state[2] ^= t;
+			this->state[3] = rotl(this->state[3], 45);
+
+			return result;
+
+		}
+
+
+		/*
+
+			Desc: Returns An Unbiased Value In [0, bound) Using Rejection
+			Sampling, So The Result Is Identical On Every Platform.
+
+			Preconditions:
+				1.) bound Must Be Greater Than 0
+
+			Postconditions:
+				1.) Returns A Uniformly Distributed Value Below bound
+
+		*/
+		uint64_t bounded(uint64_t bound)
+		{
+
+			uint64_t threshold = (0 - bound) % bound;
+
+			while (true)
+			{
+				uint64_t value = this->next();
+
+				if (value >= threshold)
+				{
+					return value % bound;
+				}
+			}
+
+		}
+
+};
+
+
+class MinePlacer
+{
+
+	public:
+
+		/*
+
+			Desc: Chooses Exactly mineCount Distinct Cells Out Of cellCount With
+			A Sparse Fisher-Yates Shuffle. Only The First mineCount Slots Of The
+			Virtual Permutation Are Drawn, And Displaced Slots Live In A Hash Map,
+			So The Work Is O(mineCount) Regardless Of Board Size. Dense Boards Use
+			A Real Array Instead; Both Paths Perform The Same Swaps And So Give
+			The Same Result For The Same Seed.
+
+			Preconditions:
+				1.) mineCount Must Not Exceed cellCount
+
+			Postconditions:
+				1.) out Will Hold mineCount Distinct Cell Indices Below cellCount
+				2.) The Same seed Will Always Produce The Same out
+
+		*/
+		static void place(uint64_t seed, unsigned int cellCount, unsigned int mineCount, std::vector<unsigned int>& out)
+		{
+
+			out.resize(mineCount);
+
+			if (mineCount > 0)
+			{
+				place(seed, cellCount, mineCount, out.data());
+			}
+
+		}
+
+
+		/*
+
+			Desc: Same As Above But Writes Into Caller-Owned Storage, So Callers
+			Can Fill Disjoint Slices Of One Array Concurrently.
+
+			Preconditions:
+				1.) mineCount Must Not Exceed cellCount
+				2.) out Must Point At mineCount Writable Entries
+
+			Postconditions:
+				1.) out[0 .. mineCount) Will Hold Distinct Cell Indices Below cellCount
+
+		*/
+		static void place(uint64_t seed, unsigned int cellCount, unsigned int mineCount, unsigned int* out)
+		{
+
+			Xoshiro256 rng(seed);
+
+			if (static_cast<uint64_t>(mineCount) * 64 >= cellCount)
+			{
+				std::vector<unsigned int> slots(cellCount);
+
+				for (unsigned int i = 0; i < cellCount; ++i)
+				{
+					slots[i] = i;
+				}
+
+				for (unsigned int i = 0; i < mineCount; ++i)
+				{
+					unsigned int j = i + static_cast<unsigned int>(rng.bounded(cellCount - i));
+					std::swap(slots[i], slots[j]);
+					out[i] = slots[i];
+				}
+
+				return;
+			}
+
+			// Slots Missing From displaced Still Hold Their Own Index
+			std::unordered_map<unsigned int, unsigned int> displaced;
+			displaced.reserve(static_cast<size_t>(mineCount) * 2);
+
+			for (unsigned int i = 0; i < mineCount; ++i)
+			{
+				unsigned int j = i + static_cast<unsigned int>(rng.bounded(cellCount - i));
+
+				auto slotJ = displaced.find(j);
+				unsigned int valueJ = slotJ == displaced.end() ? j : slotJ->second;
+
+				auto slotI = displaced.find(i);
+				unsigned int valueI = slotI == displaced.end() ? i : slotI->second;
+
+				displaced[j] = valueI;
+				out[i] = valueJ;
+			}
+
+		}
+
+};
\ No newline at end of file
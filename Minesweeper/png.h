@@ -0,0 +1,483 @@
+#pragma once
+
+
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+
+class PngWriter
+{
+
+	private:
+
+		// ~~~~~~ Deflate Limits ~~~~~~
+		static constexpr unsigned int WINDOW_SIZE = 32768;
+		static constexpr unsigned int MIN_MATCH = 3;
+		static constexpr unsigned int MAX_MATCH = 258;
+		static constexpr unsigned int HASH_BITS = 15;
+		static constexpr unsigned int MAX_PROBES = 32;		// Match Candidates Tried Per Position
+
+
+		// ~~~~~~ LSB-First Bit Stream, As Deflate Packs It ~~~~~~
+		struct BitWriter
+		{
+			std::vector<unsigned char>& out;
+			uint32_t buffer = 0;
+			unsigned int count = 0;
+
+			explicit BitWriter(std::vector<unsigned char>& out) : out(out) {}
+
+			void put(uint32_t bits, unsigned int length)
+			{
+				this->buffer |= bits << this->count;
+				this->count += length;
+
+				while (this->count >= 8)
+				{
+					this->out.push_back(static_cast<unsigned char>(this->buffer));
+					this->buffer >>= 8;
+					this->count -= 8;
+				}
+			}
+
+			// Huffman Codes Are Defined Most Significant Bit First
+			void putCode(uint32_t code, unsigned int length)
+			{
+				uint32_t reversed = 0;
+
+				for (unsigned int i = 0; i < length; ++i)
+				{
+					reversed = (reversed << 1) | ((code >> i) & 1);
+				}
+
+				this->put(reversed, length);
+			}
+
+			void flush()
+			{
+				if (this->count > 0)
+				{
+					this->out.push_back(static_cast<unsigned char>(this->buffer));
+				}
+
+				this->buffer = 0;
+				this->count = 0;
+			}
+		};
+
+
+		/*
+
+			Desc: CRC-32 (ISO 3309) As Used By PNG Chunks.
+
+			Preconditions:
+				1.) data Must Point To length Bytes
+
+			Postconditions:
+				1.) Returns The CRC Continued From crc (Start With 0)
+
+		*/
+		static uint32_t crc32(uint32_t crc, const unsigned char* data, size_t length)
+		{
+
+			static const std::vector<uint32_t> table = []()
+			{
+				std::vector<uint32_t> entries(256);
+
+				for (uint32_t n = 0; n < 256; ++n)
+				{
+					uint32_t c = n;
+
+					for (int k = 0; k < 8; ++k)
+					{
+						c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+					}
+
+					entries[n] = c;
+				}
+
+				return entries;
+			}();
+
+			crc = ~crc;
+
+			for (size_t i = 0; i < length; ++i)
+			{
+				crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+			}
+
+			return ~crc;
+
+		}
+
+
+		/*
+
+			Desc: Writes One Literal/Length Symbol With Deflate's Fixed Huffman Code.
+
+			Preconditions:
+				1.) symbol Must Be In [0, 287]
+
+			Postconditions:
+				1.) The Code Will Be Appended To bits
+
+		*/
+		static void putLiteral(BitWriter& bits, unsigned int symbol)
+		{
+
+			if (symbol < 144)
+			{
+				bits.putCode(0x30 + symbol, 8);
+			}
+			else if (symbol < 256)
+			{
+				bits.putCode(0x190 + symbol - 144, 9);
+			}
+			else if (symbol < 280)
+			{
+				bits.putCode(symbol - 256, 7);
+			}
+			else
+			{
+				bits.putCode(0xC0 + symbol - 280, 8);
+			}
+
+		}
+
+
+		/*
+
+			Desc: Writes A Back-Reference As Its Length And Distance Codes Plus
+			Extra Bits (RFC 1951 Section 3.2.5).
+
+			Preconditions:
+				1.) length Must Be In [MIN_MATCH, MAX_MATCH]
+				2.) distance Must Be In [1, WINDOW_SIZE]
+
+			Postconditions:
+				1.) The Match Will Be Appended To bits
+
+		*/
+		static void putMatch(BitWriter& bits, unsigned int length, unsigned int distance)
+		{
+
+			static const unsigned short lengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+				35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+			static const unsigned char lengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+				3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+			static const unsigned short distanceBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+				257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+			static const unsigned char distanceExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+				7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+			unsigned int code = 28;
+			while (lengthBase[code] > length) --code;
+
+			putLiteral(bits, 257 + code);
+			bits.put(length - lengthBase[code], lengthExtra[code]);
+
+			code = 29;
+			while (distanceBase[code] > distance) --code;
+
+			bits.putCode(code, 5);
+			bits.put(distance - distanceBase[code], distanceExtra[code]);
+
+		}
+
+
+		/*
+
+			Desc: Compresses data Into A zlib Stream Of One Fixed Huffman Deflate
+			Block, With Greedy LZ77 Matching Over Hash Chains. Board Frames Are
+			Mostly Flat Colour And Repeated Rows, Which Fixed Codes Handle Well
+			Enough That Dynamic Tables Are Not Worth Their Complexity Here.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns A Valid zlib (RFC 1950) Stream Of data
+
+		*/
+		static std::vector<unsigned char> deflate(const std::vector<unsigned char>& data)
+		{
+
+			std::vector<unsigned char> out = { 0x78, 0x01 };
+			BitWriter bits(out);
+
+			bits.put(1, 1);		// Final Block
+			bits.put(1, 2);		// Fixed Huffman Codes
+
+			const size_t size = data.size();
+			std::vector<int64_t> head(static_cast<size_t>(1) << HASH_BITS, -1);
+			std::vector<int64_t> previous(WINDOW_SIZE, -1);
+
+			auto hashAt = [&data](size_t i)
+			{
+				uint32_t key = data[i] | (data[i + 1] << 8) | (data[i + 2] << 16);
+				return (key * 2654435761u) >> (32 - HASH_BITS);
+			};
+
+			auto insert = [&](size_t i)
+			{
+				if (i + MIN_MATCH <= size)
+				{
+					uint32_t hash = hashAt(i);
+					previous[i % WINDOW_SIZE] = head[hash];
+					head[hash] = static_cast<int64_t>(i);
+				}
+			};
+
+			size_t i = 0;
+
+			while (i < size)
+			{
+				unsigned int bestLength = 0, bestDistance = 0;
+
+				if (i + MIN_MATCH <= size)
+				{
+					int64_t candidate = head[hashAt(i)];
+					size_t limit = std::min<size_t>(MAX_MATCH, size - i);
+
+					for (unsigned int probe = 0; probe < MAX_PROBES && candidate >= 0 && i - candidate <= WINDOW_SIZE; ++probe)
+					{
+						size_t length = 0;
+
+						while (length < limit && data[candidate + length] == data[i + length])
+						{
+							++length;
+						}
+
+						if (length > bestLength)
+						{
+							bestLength = static_cast<unsigned int>(length);
+							bestDistance = static_cast<unsigned int>(i - candidate);
+
+							if (length == limit)
+							{
+								break;
+							}
+						}
+
+						candidate = previous[candidate % WINDOW_SIZE];
+					}
+				}
+
+				if (bestLength >= MIN_MATCH)
+				{
+					putMatch(bits, bestLength, bestDistance);
+
+					for (unsigned int k = 0; k < bestLength; ++k)
+					{
+						insert(i + k);
+					}
+
+					i += bestLength;
+				}
+				else
+				{
+					putLiteral(bits, data[i]);
+					insert(i);
+					++i;
+				}
+			}
+
+			putLiteral(bits, 256);	// End Of Block
+			bits.flush();
+
+			// Adler-32 Of The Uncompressed Data, Big Endian
+			uint32_t a = 1, b = 0;
+
+			for (unsigned char byte : data)
+			{
+				a = (a + byte) % 65521;
+				b = (b + a) % 65521;
+			}
+
+			uint32_t adler = (b << 16) | a;
+
+			for (int shift = 24; shift >= 0; shift -= 8)
+			{
+				out.push_back(static_cast<unsigned char>(adler >> shift));
+			}
+
+			return out;
+
+		}
+
+
+		/*
+
+			Desc: Applies PNG Filter type To One Scanline (RFC 2083 Section 6).
+
+			Preconditions:
+				1.) row And above Must Hold stride Bytes (above Is Zero For The First Row)
+				2.) out Must Have Room For stride Bytes
+
+			Postconditions:
+				1.) out Will Hold The Filtered Scanline
+				2.) Returns The Sum Of The Filtered Bytes' Magnitudes, Read As Signed,
+				    The Usual Heuristic For Picking The Most Compressible Filter
+
+		*/
+		static unsigned long long filterRow(unsigned int type, const unsigned char* row, const unsigned char* above,
+			size_t stride, unsigned int channels, unsigned char* out)
+		{
+
+			unsigned long long cost = 0;
+
+			for (size_t x = 0; x < stride; ++x)
+			{
+				int left = x >= channels ? row[x - channels] : 0;
+				int up = above[x];
+				int upLeft = x >= channels ? above[x - channels] : 0;
+				int predictor = 0;
+
+				if (type == 1) predictor = left;
+				else if (type == 2) predictor = up;
+				else if (type == 3) predictor = (left + up) / 2;
+				else if (type == 4)
+				{
+					int estimate = left + up - upLeft;
+					int toLeft = std::abs(estimate - left), toUp = std::abs(estimate - up), toUpLeft = std::abs(estimate - upLeft);
+
+					if (toLeft <= toUp && toLeft <= toUpLeft) predictor = left;
+					else if (toUp <= toUpLeft) predictor = up;
+					else predictor = upLeft;
+				}
+
+				out[x] = static_cast<unsigned char>(row[x] - predictor);
+				cost += static_cast<unsigned long long>(std::abs(static_cast<signed char>(out[x])));
+			}
+
+			return cost;
+
+		}
+
+
+		/*
+
+			Desc: Appends One PNG Chunk (Length, Type, Data, CRC) To file.
+
+			Preconditions:
+				1.) type Must Be A Four Letter Chunk Type
+
+			Postconditions:
+				1.) The Chunk Will Be Written
+
+		*/
+		static void writeChunk(std::ofstream& file, const char* type, const std::vector<unsigned char>& data)
+		{
+
+			unsigned char header[8];
+			uint32_t length = static_cast<uint32_t>(data.size());
+
+			for (int i = 0; i < 4; ++i)
+			{
+				header[i] = static_cast<unsigned char>(length >> (24 - 8 * i));
+				header[4 + i] = static_cast<unsigned char>(type[i]);
+			}
+
+			uint32_t crc = crc32(crc32(0, header + 4, 4), data.data(), data.size());
+			unsigned char footer[4] = { static_cast<unsigned char>(crc >> 24), static_cast<unsigned char>(crc >> 16),
+				static_cast<unsigned char>(crc >> 8), static_cast<unsigned char>(crc) };
+
+			file.write(reinterpret_cast<const char*>(header), 8);
+			file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+			file.write(reinterpret_cast<const char*>(footer), 4);
+
+		}
+
+
+
+	public:
+
+		/*
+
+			Desc: Writes An 8-Bit RGB PNG From Tightly Packed RGBA Pixels, Such
+			As A glReadPixels Result. Alpha Is Dropped, As Frames Are Opaque.
+			Each Scanline Gets Whichever Filter Scores Lowest, Then The Image Is
+			Deflated Without Any Library Dependency.
+
+			Preconditions:
+				1.) rgba Must Hold width * height Pixels Of 4 Bytes
+				2.) bottomUp Must Be true If Row 0 Is The Bottom Of The Image (GL Order)
+
+			Postconditions:
+				1.) path Will Hold The Image
+				2.) Returns false If The File Could Not Be Written
+
+		*/
+		static bool write(const std::string& path, unsigned int width, unsigned int height, const unsigned char* rgba, bool bottomUp)
+		{
+
+			const unsigned int channels = 3;
+			const size_t stride = static_cast<size_t>(width) * channels;
+
+			std::vector<unsigned char> raw((stride + 1) * height);
+			std::vector<unsigned char> row(stride), above(stride, 0), candidate(stride);
+
+			for (unsigned int y = 0; y < height; ++y)
+			{
+				const unsigned char* source = rgba + static_cast<size_t>(bottomUp ? height - 1 - y : y) * width * 4;
+
+				for (unsigned int x = 0; x < width; ++x)
+				{
+					row[x * 3 + 0] = source[x * 4 + 0];
+					row[x * 3 + 1] = source[x * 4 + 1];
+					row[x * 3 + 2] = source[x * 4 + 2];
+				}
+
+				unsigned char* target = &raw[y * (stride + 1)];
+				unsigned long long bestCost = ~0ULL;
+
+				for (unsigned int type = 0; type < 5; ++type)
+				{
+					unsigned long long cost = filterRow(type, row.data(), above.data(), stride, channels, candidate.data());
+
+					if (cost < bestCost)
+					{
+						bestCost = cost;
+						target[0] = static_cast<unsigned char>(type);
+						std::copy(candidate.begin(), candidate.end(), target + 1);
+					}
+				}
+
+				row.swap(above);
+			}
+
+			std::ofstream file(path, std::ios::binary);
+
+			if (!file.is_open())
+			{
+				return false;
+			}
+
+			const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+			file.write(reinterpret_cast<const char*>(signature), 8);
+
+			std::vector<unsigned char> header(13, 0);
+
+			for (int i = 0; i < 4; ++i)
+			{
+				header[i] = static_cast<unsigned char>(width >> (24 - 8 * i));
+				header[4 + i] = static_cast<unsigned char>(height >> (24 - 8 * i));
+			}
+
+			header[8] = 8;		// Bit Depth
+			header[9] = 2;		// Truecolour
+
+			writeChunk(file, "IHDR", header);
+			writeChunk(file, "IDAT", deflate(raw));
+			writeChunk(file, "IEND", std::vector<unsigned char>());
+
+			return file.good();
+
+		}
+
+};
\ No newline at end of file
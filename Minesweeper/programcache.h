@@ -0,0 +1,376 @@
+#pragma once
+
+
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "config.h"
+
+
+class ProgramCache
+{
+
+	private:
+
+		// ~~~~~~ ARB_get_program_binary (Core In GL 4.1, Beyond The GL 3.3 Entry Points GLAD Loads) ~~~~~~
+		static constexpr GLenum PROGRAM_BINARY_RETRIEVABLE_HINT = 0x8257;
+		static constexpr GLenum PROGRAM_BINARY_LENGTH = 0x8741;
+		static constexpr GLenum NUM_PROGRAM_BINARY_FORMATS = 0x87FE;
+
+		typedef void (APIENTRYP GetProgramBinaryProc)(GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, void* binary);
+		typedef void (APIENTRYP ProgramBinaryProc)(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length);
+		typedef void (APIENTRYP ProgramParameteriProc)(GLuint program, GLenum pname, GLint value);
+
+		GetProgramBinaryProc getProgramBinary = nullptr;
+		ProgramBinaryProc programBinary = nullptr;
+		ProgramParameteriProc programParameteri = nullptr;
+
+
+		// ~~~~~~ Cache File Header ~~~~~~
+		//   Any Difference In Source Or Driver Changes key, So A Stale Or
+		//   Foreign Binary Is Never Handed To The Driver.
+		struct Header
+		{
+			uint32_t magic;
+			uint32_t version;
+			uint64_t key;
+			uint32_t format;
+			uint32_t length;
+		};
+
+		static constexpr uint32_t MAGIC = 0x4250534D;			// "MSPB" Little-Endian
+		static constexpr uint32_t VERSION = 1;
+
+
+		bool available = false;
+		bool hit = false;
+
+
+		ProgramCache() = default;
+
+
+		/*
+
+			Desc: 64-Bit FNV-1a Hash, Continued From hash.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Hash Of text Folded Into hash
+
+		*/
+		static uint64_t fnv1a(const char* text, uint64_t hash = 14695981039346656037ULL)
+		{
+
+			for (; text && *text; ++text)
+			{
+				hash = (hash ^ static_cast<unsigned char>(*text)) * 1099511628211ULL;
+			}
+
+			// Separator, So Moving Text Between Fields Changes The Hash
+			return (hash ^ 0xFF) * 1099511628211ULL;
+
+		}
+
+
+		/*
+
+			Desc: Keys A Program By Its Sources And The Driver That Compiled It,
+			As Binaries Are Only Valid For The Exact Driver Build.
+
+			Preconditions:
+				1.) OpenGL Context Must Be Active
+
+			Postconditions:
+				1.) Returns The Cache Key
+
+		*/
+		static uint64_t makeKey(const std::string& vertexSource, const std::string& fragmentSource)
+		{
+
+			uint64_t key = fnv1a(vertexSource.c_str());
+			key = fnv1a(fragmentSource.c_str(), key);
+			key = fnv1a(reinterpret_cast<const char*>(glGetString(GL_VENDOR)), key);
+			key = fnv1a(reinterpret_cast<const char*>(glGetString(GL_RENDERER)), key);
+			key = fnv1a(reinterpret_cast<const char*>(glGetString(GL_VERSION)), key);
+
+			return key;
+
+		}
+
+
+		/*
+
+			Desc: Checks Whether The Context Exposes ARB_get_program_binary,
+			Either Through GL 4.1 Or As An Extension.
+
+			Preconditions:
+				1.) OpenGL Context Must Be Active With GLAD Loaded
+
+			Postconditions:
+				1.) Returns true If The Entry Points Should Exist
+
+		*/
+		static bool hasProgramBinary()
+		{
+
+			GLint major = 0, minor = 0;
+			glGetIntegerv(GL_MAJOR_VERSION, &major);
+			glGetIntegerv(GL_MINOR_VERSION, &minor);
+
+			if (major > 4 || (major == 4 && minor >= 1))
+			{
+				return true;
+			}
+
+			GLint extensions = 0;
+			glGetIntegerv(GL_NUM_EXTENSIONS, &extensions);
+
+			for (GLint i = 0; i < extensions; ++i)
+			{
+				const char* name = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+
+				if (name && std::strcmp(name, "GL_ARB_get_program_binary") == 0)
+				{
+					return true;
+				}
+			}
+
+			return false;
+
+		}
+
+
+
+	public:
+
+		/*
+
+			Desc: Returns The Cache For The Current Context. The Game Uses A
+			Single Context, Like GLState.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Shared Cache
+
+		*/
+		static ProgramCache& get()
+		{
+
+			static ProgramCache cache;
+			return cache;
+
+		}
+
+
+		/*
+
+			Desc: Loads The Program Binary Entry Points Through load, The Same
+			Loader GLAD Was Given. The Cache Stays Off When It Is Disabled In
+			CONFIG, The Driver Lacks Program Binaries Or Offers No Binary Format
+			(Mesa Reports None With Its Own Shader Cache Disabled).
+
+			Preconditions:
+				1.) OpenGL Context Must Be Active With GLAD Loaded Through load
+
+			Postconditions:
+				1.) Returns Whether Programs Will Be Cached
+
+		*/
+		bool initialize(GLADloadproc load)
+		{
+
+			this->available = false;
+
+			if (!CONFIG::SHADER::CACHE_PROGRAMS || !hasProgramBinary())
+			{
+				return false;
+			}
+
+			this->getProgramBinary = reinterpret_cast<GetProgramBinaryProc>(load("glGetProgramBinary"));
+			this->programBinary = reinterpret_cast<ProgramBinaryProc>(load("glProgramBinary"));
+			this->programParameteri = reinterpret_cast<ProgramParameteriProc>(load("glProgramParameteri"));
+
+			GLint formats = 0;
+			glGetIntegerv(NUM_PROGRAM_BINARY_FORMATS, &formats);
+
+			this->available = this->getProgramBinary && this->programBinary && this->programParameteri && formats > 0;
+
+			return this->available;
+
+		}
+
+
+		/*
+
+			Desc: Creates A Program From The Binary Cached At path If It Was Built
+			From These Sources By This Driver. A Missing, Stale Or Truncated File
+			(Including One Whose Length Claims More Bytes Than It Holds) Is A
+			Miss; A Binary The Driver Still Rejects (For Example After An Update
+			Not Reflected In Its Version String) Is Discarded As Well.
+
+			Preconditions:
+				1.) OpenGL Context Must Be Active
+
+			Postconditions:
+				1.) Returns A Linked Program, Or 0 If It Must Be Compiled
+
+		*/
+		GLuint load(const std::string& path, const std::string& vertexSource, const std::string& fragmentSource)
+		{
+
+			this->hit = false;
+
+			if (!this->available)
+			{
+				return 0;
+			}
+
+			std::ifstream file(path, std::ios::binary);
+			Header header = {};
+
+			if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != MAGIC ||
+				header.version != VERSION || header.key != makeKey(vertexSource, fragmentSource))
+			{
+				return 0;
+			}
+
+			// A Corrupt Length Must Not Drive The Allocation, So It Is Checked Against The Bytes Left
+			std::streamoff start = file.tellg();
+			file.seekg(0, std::ios::end);
+			std::streamoff remaining = file.tellg() - start;
+			file.seekg(start);
+
+			if (remaining < 0 || static_cast<uint64_t>(remaining) < header.length)
+			{
+				return 0;
+			}
+
+			std::vector<char> binary(header.length);
+
+			if (!file.read(binary.data(), static_cast<std::streamsize>(binary.size())))
+			{
+				return 0;
+			}
+
+			GLuint program = glCreateProgram();
+			this->programBinary(program, header.format, binary.data(), static_cast<GLsizei>(binary.size()));
+
+			GLint success = 0;
+			glGetProgramiv(program, GL_LINK_STATUS, &success);
+
+			if (!success)
+			{
+				std::cerr << "Cached Shader Program Was Rejected, Recompiling...\n";
+				glDeleteProgram(program);
+				return 0;
+			}
+
+			this->hit = true;
+
+			return program;
+
+		}
+
+
+		/*
+
+			Desc: Asks The Driver To Keep program's Binary Retrievable. Must Be
+			Called Before Linking A Program That Will Be Stored.
+
+			Preconditions:
+				1.) program Must Not Be Linked Yet
+
+			Postconditions:
+				1.) The Hint Will Be Set If The Cache Is Available
+
+		*/
+		void prepare(GLuint program)
+		{
+
+			if (this->available)
+			{
+				this->programParameteri(program, PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+			}
+
+		}
+
+
+		/*
+
+			Desc: Writes program's Binary To The Cache File At path, Keyed By Its
+			Sources And The Driver, Replacing Any Previous Entry.
+
+			Preconditions:
+				1.) program Must Be Linked, With prepare Called Before Linking
+
+			Postconditions:
+				1.) The Next Launch With The Same Sources And Driver Skips Compilation
+				2.) Failures Only Cost The Cache, Never The Program
+
+		*/
+		void store(const std::string& path, GLuint program, const std::string& vertexSource, const std::string& fragmentSource)
+		{
+
+			if (!this->available)
+			{
+				return;
+			}
+
+			GLint length = 0;
+			glGetProgramiv(program, PROGRAM_BINARY_LENGTH, &length);
+
+			if (length <= 0)
+			{
+				return;
+			}
+
+			std::vector<char> binary(static_cast<size_t>(length));
+			Header header = {};
+			GLenum format = 0;
+			GLsizei written = 0;
+
+			this->getProgramBinary(program, length, &written, &format, binary.data());
+
+			header.magic = MAGIC;
+			header.version = VERSION;
+			header.key = makeKey(vertexSource, fragmentSource);
+			header.format = format;
+			header.length = static_cast<uint32_t>(written);
+
+			std::ofstream file(path, std::ios::binary | std::ios::trunc);
+			file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+			file.write(binary.data(), written);
+
+			if (!file)
+			{
+				std::cerr << "Failed To Write Shader Cache: " << path << "\n";
+			}
+
+		}
+
+
+		/*
+
+			Desc: Cache Accessors. wasHit Reports Whether The Last load Came
+			From The Cache.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Requested Value
+
+		*/
+		bool isAvailable() const { return this->available; }
+		bool wasHit() const { return this->hit; }
+
+};
\ No newline at end of file
@@ -0,0 +1,375 @@
+#pragma once
+
+
+
+#include <glad/glad.h>
+#include <iostream>
+#include "board.h"
+#include "camera.h"
+#include "frameprofiler.h"
+#include "glstate.h"
+#include "latencytracker.h"
+#include "overlay.h"
+#include "shader.h"
+#include "config.h"
+#include "vertex.h"
+
+
+class Scene
+{
+
+	private:
+
+		bool isInit = false;
+
+
+		// ~~~~~ Shader-Based Members ~~~~~~
+		Shader shader;
+		GLuint VAO = 0, VBO = 0, EBO = 0;
+
+
+		// ~~~~~ Game Logic ~~~~~~
+		Board gameBoard;
+
+
+		// ~~~~~ View ~~~~~~
+		Camera camera;
+
+
+		// ~~~~~ Frame Timing Overlay ~~~~~~
+		Overlay overlay;
+		bool showOverlay = CONFIG::PROFILER::SHOW_OVERLAY;
+
+
+		// ~~~~~ Vertex Data ~~~~~~
+		Vertex vertices[4] = {
+			{ { 1, 1 }, { 255,   0,   0 }, Vertex::NO_GLYPH }, // Top Right (Unit Corners Span The Screen In The Vertex Shader)
+			{ { 1, 0 }, {   0, 255,   0 }, Vertex::NO_GLYPH }, // Bottom Right
+			{ { 0, 0 }, {   0,   0, 255 }, Vertex::NO_GLYPH }, // Bottom Left
+			{ { 0, 1 }, { 255, 255,   0 }, Vertex::NO_GLYPH }  // Top Left
+		};
+
+		unsigned int indices[6] = {
+				0, 1, 3,   // First Triangle
+				1, 2, 3    // Second Triangle
+		};
+
+
+		/*
+
+			Desc: Sets Up Vertex Array Objects And Buffers For OpenGL Rendering
+			Including Game Board Initialization And Vertex Attribute Configuration.
+
+			Preconditions:
+				1.) Scene Must Be In Process Of Initialization
+				2.) OpenGL Context Must Be Active
+				3.) Shader Program Must Be Successfully Loaded
+
+			Postconditions:
+				1.) Game Board Will Be Initialized With All Resources And Its Own VAOs
+				2.) The Background Quad's Vertex Array Object (VAO) And Buffers Will Be
+				    Generated And Bound
+				3.) Vertex Attributes Will Be Configured For Position And Color
+
+		*/
+		void initializeVertexData(uint64_t seed)
+		{
+
+			// Initialize Game Board
+			this->gameBoard.initialize(seed);
+
+			// Build Our Shader Buffers
+			glGenVertexArrays(1, &this->VAO);
+			glGenBuffers(1, &this->VBO);
+			glGenBuffers(1, &this->EBO);
+
+			// Bind Our Buffers
+			GLState::get().bindVertexArray(this->VAO);
+			GLState::get().bindArrayBuffer(this->VBO);
+			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->EBO);
+
+			// Load Data Into Buffers
+			glBufferData(GL_ARRAY_BUFFER, sizeof(this->vertices), this->vertices, GL_STATIC_DRAW);
+			glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(this->indices), this->indices, GL_STATIC_DRAW);
+
+			// Set Vertex Attribute Pointers
+			glVertexAttribPointer(0, 2, GL_UNSIGNED_SHORT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+			glVertexAttribPointer(1, 3, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+
+			// Enable Vertex Attributes
+			glEnableVertexAttribArray(0);
+			glEnableVertexAttribArray(1);
+
+		}
+
+
+
+	public:
+
+		/*
+
+			Desc: Constructs A Scene Around A Board Of The Given Size. Nothing
+			Touches OpenGL Until initialize, So The Scene Can Be Built Before
+			Whichever Context (GLFW Window Or Offscreen) Will Draw It.
+
+			Preconditions:
+				1.) mineCount Must Not Exceed row_count * col_count
+
+			Postconditions:
+				1.) The Scene Will Be Ready For initialize() Call
+
+		*/
+		Scene(const unsigned int& row_count = CONFIG::BOARD::ROW_COUNT,
+			const unsigned int& col_count = CONFIG::BOARD::COL_COUNT,
+			const unsigned int& mineCount = CONFIG::BOARD::MINE_COUNT) :
+			gameBoard(CONFIG::BOARD::WIDTH, CONFIG::BOARD::HEIGHT, CONFIG::BOARD::X_OFFSET, CONFIG::BOARD::Y_OFFSET,
+				row_count, col_count, mineCount)
+		{
+		}
+
+
+		/*
+
+			Desc: Creates Every GL Resource The Scene Draws With: The Default
+			Shader, The Background Quad And The Board. This Is All Of The Game's
+			GL Setup That Does Not Depend On Where The Context Came From.
+
+			Preconditions:
+				1.) A GL 3.3 Core Context Must Be Current With GLAD Loaded
+				2.) Scene Must Not Already Be Initialized
+
+			Postconditions:
+				1.) Shader Program Will Be Loaded, Compiled And Active
+				2.) Vertex Data Will Be Initialized And The Board Ready, Mines Placed From seed
+				3.) The Frame Profiler's GPU Timers And The Overlay Will Be Created
+				4.) The Viewport Will Be width x height
+				5.) Returns true On Success
+
+		*/
+		bool initialize(uint64_t seed, unsigned int width, unsigned int height)
+		{
+
+			if (this->isInit)
+			{
+				std::cerr << "Scene Has Already Been Initialized...\n";
+				return false;
+			}
+
+			// Load Default Shader
+			if (!this->shader.loadShader(CONFIG::SHADER::VERTEX_PATH, CONFIG::SHADER::FRAGMENT_PATH))
+			{
+				std::cerr << "Default Shader Loading Has Failed...\n";
+				return false;
+			}
+
+			this->initializeVertexData(seed);
+			this->overlay.initialize();
+			FrameProfiler::get().initialize();
+
+			// Constant Render State: Background Colour And Texture Units. Every Sampler Gets Its
+			// Own Unit Before The First Draw, As Samplers Of Different Targets May Not Share One
+			glClearColor(CONFIG::SHADER::COLORS::CLEAR_COLOR_R,
+				CONFIG::SHADER::COLORS::CLEAR_COLOR_G,
+				CONFIG::SHADER::COLORS::CLEAR_COLOR_B, 1.0f);
+
+			this->shader.use();
+			glUniform1i(this->shader.getUniform("numberAtlas"), 0);
+			glUniform1i(this->shader.getUniform("boardState"), 1);
+			glUniform1i(this->shader.getUniform("lodPyramid"), 2);
+			glUniform1i(this->shader.getUniform("cellRecords"), 3);
+
+			this->setViewport(width, height);
+			this->isInit = true;
+
+			return true;
+
+		}
+
+
+		/*
+
+			Desc: Resizes The Viewport The Scene Draws Into.
+
+			Preconditions:
+				1.) OpenGL Context Must Be Active
+				2.) width And height Must Be The Current Framebuffer Size
+
+			Postconditions:
+				1.) The GL Viewport, The Board's One Pixel Grid Margin And The
+				    Overlay's Layout Will Match The New Size
+
+		*/
+		void setViewport(unsigned int width, unsigned int height)
+		{
+
+			glViewport(0, 0, width, height);
+			this->gameBoard.setViewport(width, height);
+			this->overlay.setViewport(width, height);
+
+		}
+
+
+		/*
+
+			Desc: Clears The Bound Framebuffer With The Configured Background Color
+			Preparing For The Next Frame Rendering.
+
+			Preconditions:
+				1.) OpenGL Context Must Be Active
+				2.) The Clear Colour Must Have Been Set In initialize
+
+			Postconditions:
+				1.) Color Buffer Will Be Cleared With Background Color
+
+		*/
+		void clear()
+		{
+
+			GLState::get().call(glClear, GL_COLOR_BUFFER_BIT);
+
+		}
+
+
+		/*
+
+			Desc: Renders The Current Frame Including Background And Game Board
+			With Proper Shader Uniforms And Texture Binding. Each Is Bracketed
+			By A GPU Timer Of The Frame Profiler, Whose Frame The Caller Ends.
+
+			Preconditions:
+				1.) OpenGL Context Must Be Active
+				2.) Scene Must Be Initialized, Leaving Its Shader The Active Program
+				3.) All Vertex Data Must Be Current
+
+			Postconditions:
+				1.) Background Quad Will Be Rendered From Its Own VAO
+				2.) Shader Uniforms Will Be Set For Board Rendering Through Locations
+				    Resolved At Load Time
+				3.) Game Board Will Be Rendered With Textures Through The Camera
+				4.) The Timing Overlay Will Be Drawn On Top If Shown
+
+		*/
+		void render()
+		{
+
+			GLState& gl = GLState::get();
+			FrameProfiler& profiler = FrameProfiler::get();
+
+			// The Background Quad Is Untextured
+			profiler.beginGpu(FrameProfiler::GPU_QUAD);
+			gl.bindVertexArray(this->VAO);
+			gl.call(glUniform1i, this->shader.getUniform("useTexture"), 0);
+			gl.call(glDrawElements, GL_TRIANGLES, 6, GL_UNSIGNED_INT, (void*)0);
+			profiler.endGpu();
+
+			// Set Shader Uniforms For Board Rendering
+			gl.call(glUniform1i, this->shader.getUniform("useTexture"), 1);
+
+			profiler.beginGpu(FrameProfiler::GPU_BOARD);
+			this->gameBoard.render(this->shader, this->camera);
+			profiler.endGpu();
+
+			if (this->showOverlay)
+			{
+				this->overlay.render(this->shader);
+			}
+
+		}
+
+
+		/*
+
+			Desc: Clicks The Point Under ndc, Mapping It Through The Camera's
+			Inverse Transform To World Space And Forwarding It To The Board.
+			Every Click, Real Or Scripted, Enters Here, So This Is Where Its
+			Latency Tracking Begins.
+
+			Preconditions:
+				1.) Scene Must Be Initialized
+				2.) ndc Must Be In Normalized Device Coordinates
+
+			Postconditions:
+				1.) Left Clicks Reveal And Right Clicks Flag The Cell Under ndc
+				2.) Returns true If The Board Changed (It Needs Redrawing)
+				3.) A Click That Changed The Board Will Await LatencyTracker::presented
+
+		*/
+		bool click(const glm::vec2& ndc, bool isRightClick)
+		{
+
+			LatencyTracker& tracker = LatencyTracker::get();
+			tracker.begin();
+
+			glm::vec2 world = this->camera.ndcToWorld(ndc);
+			bool changed = this->gameBoard.handleClick(world.x, world.y, isRightClick);
+
+			tracker.end(changed);
+			return changed;
+
+		}
+
+
+		/*
+
+			Desc: Deletes The Background Quad's And Overlay's GL Objects, And
+			The Frame Profiler's Queries.
+
+			Preconditions:
+				1.) The Context The Scene Was Initialized In Must Be Current
+
+			Postconditions:
+				1.) isInit Flag Will Be Set To false
+
+		*/
+		void terminate()
+		{
+
+			if (!this->isInit)
+			{
+				return;
+			}
+
+			glDeleteVertexArrays(1, &this->VAO);
+			glDeleteBuffers(1, &this->VBO);
+			glDeleteBuffers(1, &this->EBO);
+
+			this->overlay.terminate();
+			FrameProfiler::get().terminate();
+
+			this->isInit = false;
+
+		}
+
+
+		/*
+
+			Desc: Scene Accessors, For Input Handling (Camera) And Scripted
+			Moves (Board).
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Requested Member
+
+		*/
+		Camera& getCamera() { return this->camera; }
+		Board& getBoard() { return this->gameBoard; }
+
+
+		/*
+
+			Desc: Shows Or Hides The Timing Overlay.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) The Next render Will Draw The Overlay Only If shown
+				2.) isOverlayShown Returns The Current Setting
+
+		*/
+		void setOverlay(bool shown) { this->showOverlay = shown; }
+		bool isOverlayShown() const { return this->showOverlay; }
+
+};
\ No newline at end of file
@@ -5,7 +5,12 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <unordered_map>
 #include <glad/glad.h>
+#include "config.h"
+#include "glstate.h"
+#include "programcache.h"
+#include "shadersources.h"
 
 
 
@@ -14,7 +19,46 @@ class Shader
 
 private:
 
-	GLuint progID;
+	GLuint progID = 0;
+
+	// Active Uniform Locations By Name, Resolved Once After Linking
+	std::unordered_map<std::string, GLint> uniforms;
+
+
+	/*
+
+		Desc: Records The Location Of Every Active Uniform In The Linked Program
+		So Rendering Never Has To Look One Up By Name.
+
+		Preconditions:
+			1.) progID Must Be A Successfully Linked Program
+
+		Postconditions:
+			1.) uniforms Will Map Each Active Uniform Name To Its Location
+
+	*/
+	void resolveUniforms()
+	{
+
+		GLint count = 0, maxLength = 0;
+		glGetProgramiv(this->progID, GL_ACTIVE_UNIFORMS, &count);
+		glGetProgramiv(this->progID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+		std::string name(static_cast<size_t>(maxLength), '\0');
+		this->uniforms.clear();
+
+		for (GLint i = 0; i < count; ++i)
+		{
+			GLsizei length = 0;
+			GLint size = 0;
+			GLenum type = 0;
+			glGetActiveUniform(this->progID, static_cast<GLuint>(i), maxLength, &length, &size, &type, &name[0]);
+
+			std::string uniform = name.substr(0, static_cast<size_t>(length));
+			this->uniforms[uniform] = glGetUniformLocation(this->progID, uniform.c_str());
+		}
+
+	}
 
 	/*
 
@@ -90,34 +134,22 @@ private:
 	}
 
 
-public:
-
 	/*
 
-		Desc: Main Initialization Function Which Will Ingest The Paths To Both
-		Our .vert & .frag Shader And Will Grab The Source Code From The Given Files
-		Then Compile The Source Code Into Executable Logic For The GPU.
+		Desc: Compiles And Links A Program From source Code, Setting The
+		Retrievable Hint First So The Program Cache Can Store Its Binary.
 
 		Preconditions:
-			1.) vertexPath & fragmentPath Are Both Valid Files
-			2.) vertexPath & fragmentPath Both Contain Syntactically Correct Shader Code
+			1.) vertexSource & fragmentSource Contain Syntactically Correct Shader Code
 
 		Postconditions:
-			1.) Both Our .vert & .frag Shader Will Be Live And Associated With A Shader
-			2.) If Loading Fails, Will Return & Notify
+			1.) progID Will Be The Linked Program
+			2.) If Linking Fails, Will Return false & Notify
 
 	*/
-	bool loadShader(const std::string& vertexPath, const std::string& fragmentPath)
+	bool compileProgram(const std::string& vertexSource, const std::string& fragmentSource)
 	{
 
-		std::string vertexSource = loadShaderSource(vertexPath);
-		std::string fragmentSource = loadShaderSource(fragmentPath);
-
-		if (vertexSource.empty() || fragmentSource.empty())
-		{
-			return false;
-		}
-
 		GLuint vertexShader = compileShader(vertexSource, GL_VERTEX_SHADER);
 		GLuint fragmentShader = compileShader(fragmentSource, GL_FRAGMENT_SHADER);
 
@@ -125,8 +157,13 @@ public:
 		this->progID = glCreateProgram();
 		glAttachShader(this->progID, vertexShader);
 		glAttachShader(this->progID, fragmentShader);
+		ProgramCache::get().prepare(this->progID);
 		glLinkProgram(this->progID);
 
+		// Cleanup Intermediate Shaders
+		glDeleteShader(vertexShader);
+		glDeleteShader(fragmentShader);
+
 		// Check Linking 
 		GLint success;
 		glGetProgramiv(this->progID, GL_LINK_STATUS, &success);
@@ -138,17 +175,85 @@ public:
 			glGetProgramInfoLog(this->progID, 512, nullptr, logReport);
 			std::cerr << "Program Linking Failed: " << logReport << std::endl;
 
-			glDeleteShader(vertexShader);
-			glDeleteShader(fragmentShader);
 			glDeleteProgram(this->progID);
+			this->progID = 0;
 
 			return false;
 
 		}
 
-		// Cleanup Intermediate Shaders
-		glDeleteShader(vertexShader);
-		glDeleteShader(fragmentShader);
+		return true;
+
+	}
+
+
+public:
+
+	/*
+
+		Desc: Main Initialization Function Which Will Ingest The Paths To Both
+		Our .vert & .frag Shader And Will Grab The Source Code From The Given Files
+		(Or From ShaderSources When CONFIG::SHADER::EMBED_SOURCES Is Set) Then
+		Create The Program. A Binary Cached By A Previous Launch With The Same
+		Sources And Driver Is Used When Available; Otherwise The Sources Are
+		Compiled And The Result Cached In vertexPath's Directory As
+		NAME.shadercache.
+
+		Preconditions:
+			1.) vertexPath & fragmentPath Are Both Valid Files (Unless Embedded)
+			2.) vertexPath & fragmentPath Both Contain Syntactically Correct Shader Code
+
+		Postconditions:
+			1.) Both Our .vert & .frag Shader Will Be Live And Associated With A Shader
+			2.) If Loading Fails, Will Return & Notify
+
+	*/
+	bool loadShader(const std::string& vertexPath, const std::string& fragmentPath)
+	{
+
+		std::string vertexSource, fragmentSource;
+
+		if (CONFIG::SHADER::EMBED_SOURCES)
+		{
+			vertexSource = ShaderSources::vertex();
+			fragmentSource = ShaderSources::fragment();
+		}
+		else
+		{
+			vertexSource = loadShaderSource(vertexPath);
+			fragmentSource = loadShaderSource(fragmentPath);
+
+			if (vertexSource.empty() || fragmentSource.empty())
+			{
+				return false;
+			}
+
+			// Builds Outside The Minesweeper Project Regenerate shadersources.h By Hand
+			if (vertexPath == CONFIG::SHADER::VERTEX_PATH && fragmentPath == CONFIG::SHADER::FRAGMENT_PATH &&
+				(vertexSource != ShaderSources::vertex() || fragmentSource != ShaderSources::fragment()))
+			{
+				std::cerr << "Warning: shadersources.h Differs From The Shader Files; Run embedshaders.py Before Embedding...\n";
+			}
+		}
+
+		ProgramCache& cache = ProgramCache::get();
+		size_t dot = vertexPath.find_last_of('.'), slash = vertexPath.find_last_of("/\\");
+		std::string cachePath = (dot != std::string::npos && (slash == std::string::npos || dot > slash) ?
+			vertexPath.substr(0, dot) : vertexPath) + ".shadercache";
+
+		this->progID = cache.load(cachePath, vertexSource, fragmentSource);
+
+		if (this->progID == 0)
+		{
+			if (!this->compileProgram(vertexSource, fragmentSource))
+			{
+				return false;
+			}
+
+			cache.store(cachePath, this->progID, vertexSource, fragmentSource);
+		}
+
+		this->resolveUniforms();
 
 		return true;
 
@@ -174,6 +279,27 @@ public:
 	}
 
 
+	/*
+
+		Desc: Returns The Location Of A Uniform Resolved At Load Time.
+
+		Preconditions:
+			1.) The Shader Has Been Initialized And Compiled
+
+		Postconditions:
+			1.) Returns The Uniform's Location, Or -1 If The Program Has No Such
+			    Active Uniform (Setting -1 Is A Silent No-Op In OpenGL)
+
+	*/
+	GLint getUniform(const std::string& name) const
+	{
+
+		auto found = this->uniforms.find(name);
+		return found == this->uniforms.end() ? -1 : found->second;
+
+	}
+
+
 	/*
 
 		Desc: Will Activate The Given Shader To Be Utilized In The Rendering Of
@@ -184,12 +310,13 @@ public:
 
 		Postconditions:
 			1.) Rendering Will Now Utilize This Given Shader For It's Rendering
+			2.) No GL Call Is Made If It Is Already In Use
 
 	*/
 	void use()
 	{
 
-		glUseProgram(this->progID);
+		GLState::get().useProgram(this->progID);
 
 	}
 
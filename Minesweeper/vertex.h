@@ -2,11 +2,31 @@
 
 
 
+// Packed To 8 Bytes For The Background Quad, Whose Unit Corners The Vertex Shader Maps To
+// Clip Space, And The Overlay, One Per Glyph Cell; unorm And NO_GLYPH Are Shared With CellVertex
 struct Vertex
 {
 
-	float position[3];
-	float color[3];
-	float uvs[2];
+	unsigned short position[2];		// Unit Corner, Or Normalized Screen Position Of An Overlay Glyph
+	unsigned char color[3];			// Normalized RGB
+	unsigned char glyph;			// Overlay Atlas Slot; Always NO_GLYPH For The Background
+
+	static constexpr unsigned char NO_GLYPH = 0xFF;
+
+
+	// Converts A [0, 1] Colour Channel To Its Normalized Byte
+	static unsigned char unorm(float value) { return static_cast<unsigned char>(value * 255.0f + 0.5f); }
+
+};
+
+
+
+// One Per Cell In Per-Vertex Mode, Read By default.vert As An RGBA8UI Buffer Texel; Cell
+// Positions And Quad Corners Come From gl_VertexID, So No Positions Or Indices Are Stored
+struct CellVertex
+{
+
+	unsigned char color[3];			// Normalized RGB
+	unsigned char glyph;			// Atlas Slot Drawn Over The Cell, Or Vertex::NO_GLYPH
 
 };
\ No newline at end of file
@@ -4,11 +4,18 @@
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include <algorithm>
+#include <cmath>
+#include <ctime>
 #include <iostream>
-#include "board.h"
-#include "shader.h"
+#include "camera.h"
+#include "frameprofiler.h"
+#include "glstate.h"
+#include "inputscript.h"
+#include "latencytracker.h"
+#include "programcache.h"
+#include "scene.h"
 #include "config.h"
-#include "vertex.h"
 
 
 class Window
@@ -23,27 +30,36 @@ class Window
 		bool isInit = false;
 
 
-		// ~~~~~ Shader-Based Members ~~~~~~
-		Shader shader;
-		GLuint VAO, VBO, EBO;
+		// ~~~~~ Board Seed ~~~~~~
+		uint64_t seed;
 
 
-		// ~~~~~ Game Logic ~~~~~~
-		Board gameBoard;
+		// ~~~~~ Shader, Background And Board ~~~~~~
+		Scene scene;
 
 
-		// ~~~~~ Vertex Data ~~~~~~
-		Vertex vertices[4] = {
-			{ {  1.0f,  1.0f, 0.0f }, { 1.0f, 0.0f, 0.0f }, { 0.0f, 0.0f }}, // Add UVs
-			{ {  1.0f, -1.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f }}, // Add UVs
-			{ { -1.0f, -1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 0.0f }}, // Add UVs
-			{ { -1.0f,  1.0f, 0.0f }, { 1.0f, 1.0f, 0.0f }, { 0.0f, 0.0f }}  // Add UVs
-		};
+		// ~~~~~ Panning (Wheel Zooms, Middle Button Drag Pans) ~~~~~~
+		bool isPanning = false;
+		glm::vec2 panCursor = glm::vec2(0.0f);
 
-		unsigned int indices[6] = {
-				0, 1, 3,   // First Triangle
-				1, 2, 3    // Second Triangle
-		};
+
+		// ~~~~~ Frame Pacing ~~~~~~
+		bool needsRedraw = true;
+		double lastFrameTime = 0.0;
+		unsigned long long framesDrawn = 0;
+		unsigned long long framesSkipped = 0;
+
+
+		// ~~~~~ Scripted Input, Replayed From CONFIG::INPUT::SCRIPT_PATH ~~~~~~
+		InputScript script;
+		bool hasScript = false;
+		double scriptStart = 0.0;
+
+
+		// ~~~~~ GL Call Accounting ~~~~~~
+		unsigned long long lastFrameCalls = 0;
+		unsigned long long totalFrameCalls = 0;
+		unsigned long long totalSkippedBinds = 0;
 
 
 		/*
@@ -57,11 +73,10 @@ class Window
 
 			Postconditions:
 				1.) GLFW Will Be Initialized And Window Created
-				2.) OpenGL Context Will Be Established With GLAD
-				3.) Shader Program Will Be Loaded And Compiled
-				4.) Vertex Data Will Be Initialized For Rendering
-				5.) Game Board Will Be Ready For Use
-				6.) isInit Flag Will Be Set To true On Success
+				2.) OpenGL Context Will Be Established With GLAD, And The Program Cache Set Up
+				3.) The Scene (Shader, Background Quad And Board) Will Be Initialized
+				4.) The Input Script, If Configured, Will Be Loaded
+				5.) isInit Flag Will Be Set To true On Success
 
 		*/
 		bool initialize()
@@ -79,8 +94,8 @@ class Window
 				return false;
 			}
 
-			// Seed Randomizer
-			srand(static_cast<unsigned int>(time(0)));
+			// Seed The Board From The Clock
+			this->seed = static_cast<uint64_t>(time(0));
 
 			glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
 			glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
@@ -103,21 +118,32 @@ class Window
 				return false;
 			}
 
-			glViewport(0, 0, this->win_width, this->win_height);
+			ProgramCache::get().initialize((GLADloadproc)glfwGetProcAddress);
 
 			// Set Callbacks
 			glfwSetWindowSizeCallback(this->window, this->frameBufferSizeCallback);
+			glfwSetWindowRefreshCallback(this->window, this->windowRefreshCallback);
 			glfwSetMouseButtonCallback(this->window, this->mouseButtonCallback);
+			glfwSetScrollCallback(this->window, this->scrollCallback);
+			glfwSetCursorPosCallback(this->window, this->cursorPosCallback);
+			glfwSetKeyCallback(this->window, this->keyCallback);
 			glfwSetWindowUserPointer(this->window, this);
 
-			// Load Default Shader
-			if (!this->shader.loadShader(CONFIG::SHADER::VERTEX_PATH, CONFIG::SHADER::FRAGMENT_PATH))
+			if (!this->scene.initialize(this->seed, this->win_width, this->win_height))
 			{
-				std::cerr << "Default Shader Loading Has Failed...\n";
 				return false;
 			}
 
-			this->initializeVertexData();
+			if (CONFIG::INPUT::SCRIPT_PATH[0] != '\0')
+			{
+				if (!this->script.load(CONFIG::INPUT::SCRIPT_PATH))
+				{
+					return false;
+				}
+
+				this->hasScript = true;
+				LatencyTracker::get().setScripted(true);
+			}
 
 			this->isInit = true;
 
@@ -128,189 +154,241 @@ class Window
 
 		/*
 	
-			Desc: Sets Up Vertex Array Objects And Buffers For OpenGL Rendering
-			Including Game Board Initialization And Vertex Attribute Configuration.
+			Desc: Static Callback Function For Handling Mouse Button Events
+			Distinguishing Between Left And Right Clicks For Game Interaction,
+			And The Middle Button For Panning.
 
 			Preconditions:
-				1.) Window Must Be In Process Of Initialization
-				2.) OpenGL Context Must Be Active
-				3.) Shader Program Must Be Successfully Loaded
+				1.) Window Must Have Valid User Pointer Set
+				2.) GLFW Must Be Properly Initialized
+				3.) Mouse Button Event Must Have Occurred
 
 			Postconditions:
-				1.) Vertex Array Object (VAO) Will Be Created And Bound
-				2.) Vertex And Element Buffer Objects Will Be Generated
-				3.) Game Board Will Be Initialized With All Resources
-				4.) Vertex Attributes Will Be Configured For Position And Color
-				5.) All Vertex Attribute Arrays Will Be Enabled
+				1.) Left Mouse Button Press Will Trigger Cell Revelation
+				2.) Right Mouse Button Press Will Trigger Flag Toggle
+				3.) Appropriate handleMouseClick Will Be Called With Click Type
+				4.) Middle Mouse Button Will Start Or End A Pan Drag
 
 		*/
-		void initializeVertexData()
+		static void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
 		{
 
-			if (this->isInit)
+			Window* windowInstance = static_cast<Window*>(glfwGetWindowUserPointer(window));
+
+			if (!windowInstance)
 			{
-				std::cerr << "Window Vertex Data Was Already Initialized...\n";
 				return;
 			}
 
-			// Build Our Shader Buffers
-			glGenVertexArrays(1, &this->VAO);
-			glGenBuffers(1, &this->VBO);
-			glGenBuffers(1, &this->EBO);
+			if (button == GLFW_MOUSE_BUTTON_MIDDLE)
+			{
+				double xpos, ypos;
+				glfwGetCursorPos(window, &xpos, &ypos);
 
-			// Bind Our Buffers
-			glBindVertexArray(this->VAO);
+				windowInstance->isPanning = action == GLFW_PRESS;
+				windowInstance->panCursor = windowInstance->cursorToNdc(xpos, ypos);
+			}
+			else if (action == GLFW_PRESS)
+			{
+				double xpos, ypos;
+				glfwGetCursorPos(window, &xpos, &ypos);
 
-			// Initialize Game Board
-			this->gameBoard.initialize();
+				if (button == GLFW_MOUSE_BUTTON_LEFT)
+				{
+					windowInstance->handleMouseClick(xpos, ypos, false); // Left Click = Reveal
+				}
+				else if (button == GLFW_MOUSE_BUTTON_RIGHT)
+				{
+					windowInstance->handleMouseClick(xpos, ypos, true); // Right Click = Flag
+				}
+			}
 
-			glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
-			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->EBO);
+		}
 
-			// Load Data Into Buffers
-			glBufferData(GL_ARRAY_BUFFER, sizeof(this->vertices), this->vertices, GL_STATIC_DRAW);
-			glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(this->indices), this->indices, GL_STATIC_DRAW);
 
-			// Set Vertex Attribute Pointers
-			glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
-			glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+		/*
+
+			Desc: Static Callback For The Mouse Wheel, Zooming The Camera By
+			CONFIG::CAMERA::ZOOM_STEP Per Notch About The Cursor.
 
-			// Enable Vertex Attributes
-			glEnableVertexAttribArray(0);
-			glEnableVertexAttribArray(1);
-			glEnableVertexAttribArray(2);
+			Preconditions:
+				1.) Window Must Have Valid User Pointer Set
+
+			Postconditions:
+				1.) The Camera Will Be Zoomed And A Redraw Requested If It Changed
+
+		*/
+		static void scrollCallback(GLFWwindow* window, double xoffset, double yoffset)
+		{
+
+			Window* windowInstance = static_cast<Window*>(glfwGetWindowUserPointer(window));
+
+			if (windowInstance)
+			{
+				double xpos, ypos;
+				glfwGetCursorPos(window, &xpos, &ypos);
+
+				float factor = std::pow(CONFIG::CAMERA::ZOOM_STEP, static_cast<float>(yoffset));
+
+				if (windowInstance->scene.getCamera().zoomAt(windowInstance->cursorToNdc(xpos, ypos), factor))
+				{
+					windowInstance->needsRedraw = true;
+				}
+			}
 
 		}
 
 
 		/*
-	
-			Desc: Static Callback Function For Handling Mouse Button Events
-			Distinguishing Between Left And Right Clicks For Game Interaction.
+
+			Desc: Static Callback For Cursor Motion, Panning The Camera While
+			The Middle Button Is Held So The Board Follows The Cursor.
 
 			Preconditions:
 				1.) Window Must Have Valid User Pointer Set
-				2.) GLFW Must Be Properly Initialized
-				3.) Mouse Button Event Must Have Occurred
 
 			Postconditions:
-				1.) Left Mouse Button Press Will Trigger Cell Revelation
-				2.) Right Mouse Button Press Will Trigger Flag Toggle
-				3.) Appropriate handleMouseClick Will Be Called With Click Type
+				1.) The Camera Will Be Panned And A Redraw Requested If It Changed
 
 		*/
-		static void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
+		static void cursorPosCallback(GLFWwindow* window, double xpos, double ypos)
 		{
 
-			if (action == GLFW_PRESS)
+			Window* windowInstance = static_cast<Window*>(glfwGetWindowUserPointer(window));
+
+			if (windowInstance && windowInstance->isPanning)
 			{
-				Window* windowInstance = static_cast<Window*>(glfwGetWindowUserPointer(window));
-				if (windowInstance)
+				glm::vec2 cursor = windowInstance->cursorToNdc(xpos, ypos);
+
+				if (windowInstance->scene.getCamera().pan(cursor - windowInstance->panCursor))
 				{
-					if (button == GLFW_MOUSE_BUTTON_LEFT)
-					{
-						windowInstance->handleMouseClick(false); // Left Click = Reveal
-					}
-					else if (button == GLFW_MOUSE_BUTTON_RIGHT)
-					{
-						windowInstance->handleMouseClick(true); // Right Click = Flag
-					}
+					windowInstance->needsRedraw = true;
 				}
+
+				windowInstance->panCursor = cursor;
 			}
 
 		}
 
 
 		/*
-	
-			Desc: Processes Mouse Click Events By Converting Screen Coordinates
-			To Normalized Device Coordinates And Forwarding To Game Board.
+
+			Desc: Static Callback For Keys: F3 Shows Or Hides The Timing
+			Overlay And F4 Exports The Frame Profiler's Percentiles To
+			CONFIG::PROFILER::EXPORT_PATH.
 
 			Preconditions:
-				1.) Window Must Be Properly Initialized
-				2.) Game Board Must Be Active And Ready
-				3.) Mouse Cursor Must Be Within Window Bounds
+				1.) Window Must Have Valid User Pointer Set
 
 			Postconditions:
-				1.) Mouse Position Will Be Retrieved From GLFW
-				2.) Screen Coordinates Will Be Converted To Normalized Coordinates
-				3.) Game Board handleClick Will Be Called With Converted Coordinates
+				1.) The Overlay Will Be Toggled And A Redraw Requested, Or The
+				    Percentiles Written
 
 		*/
-		void handleMouseClick(bool isRightClick = false)
+		static void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
 		{
 
-			double xpos, ypos;
-			glfwGetCursorPos(this->window, &xpos, &ypos);
+			Window* windowInstance = static_cast<Window*>(glfwGetWindowUserPointer(window));
 
-			// Convert Screen Coordinates To Normalized Device Coordinates
-			float normalizedX = (2.0f * xpos) / this->win_width - 1.0f;
-			float normalizedY = 1.0f - (2.0f * ypos) / this->win_height;
+			if (!windowInstance || action != GLFW_PRESS)
+			{
+				return;
+			}
 
-			// Convert To Board Coordinates And Update Cell
-			this->gameBoard.handleClick(normalizedX, normalizedY, isRightClick);
+			if (key == GLFW_KEY_F3)
+			{
+				windowInstance->scene.setOverlay(!windowInstance->scene.isOverlayShown());
+				windowInstance->needsRedraw = true;
+			}
+			else if (key == GLFW_KEY_F4)
+			{
+				windowInstance->exportTimings();
+			}
 
 		}
 
 
 		/*
-	
-			Desc: Clears The Screen Buffer With The Configured Background Color
-			Preparing For The Next Frame Rendering.
+
+			Desc: Writes The Frame Profiler's Percentiles To
+			CONFIG::PROFILER::EXPORT_PATH, Unless Profiling Or Exporting Is Off.
 
 			Preconditions:
 				1.) OpenGL Context Must Be Active
-				2.) CONFIG Color Values Must Be Available
 
 			Postconditions:
-				1.) Color Buffer Will Be Cleared With Background Color
-				2.) Screen Will Be Ready For New Frame Rendering
+				1.) The Export File Will Hold The Current Percentiles
 
 		*/
-		void clear()
+		void exportTimings()
 		{
 
-			glClearColor(CONFIG::SHADER::COLORS::CLEAR_COLOR_R,
-				CONFIG::SHADER::COLORS::CLEAR_COLOR_G,
-				CONFIG::SHADER::COLORS::CLEAR_COLOR_B, 1.0f);
-			glClear(GL_COLOR_BUFFER_BIT);
+			if (!CONFIG::PROFILER::ENABLED || CONFIG::PROFILER::EXPORT_PATH[0] == '\0')
+			{
+				return;
+			}
+
+			if (FrameProfiler::get().exportTo(CONFIG::PROFILER::EXPORT_PATH))
+			{
+				std::cout << "Frame Timings Written To " << CONFIG::PROFILER::EXPORT_PATH << "\n";
+			}
+			else
+			{
+				std::cerr << "Failed To Write Frame Timings: " << CONFIG::PROFILER::EXPORT_PATH << "\n";
+			}
 
 		}
 
 
 		/*
-	
-			Desc: Renders The Current Frame Including Background And Game Board
-			With Proper Shader Uniforms And Texture Binding.
+
+			Desc: Converts A Cursor Position In Window Pixels To Normalized
+			Device Coordinates.
 
 			Preconditions:
-				1.) OpenGL Context Must Be Active
-				2.) Shader Program Must Be Bound And Ready
-				3.) All Vertex Data Must Be Current
+				1.) None
 
 			Postconditions:
-				1.) Background Quad Will Be Rendered
-				2.) Shader Uniforms Will Be Set For Board Rendering
-				3.) Game Board Will Be Rendered With Textures
+				1.) Returns The Cursor In [-1, 1] With +y Up
 
 		*/
-		void render()
+		glm::vec2 cursorToNdc(double xpos, double ypos) const
 		{
 
-			// Bind Our Buffers
-			glBindBuffer(GL_ARRAY_BUFFER, this->VBO);
-			glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->EBO);
+			return glm::vec2((2.0f * xpos) / this->win_width - 1.0f, 1.0f - (2.0f * ypos) / this->win_height);
 
-			glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
-			glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)(sizeof(float) * 3));
+		}
 
-			glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
 
-			// Set Shader Uniforms For Board Rendering
-			glUniform1i(glGetUniformLocation(this->shader.getProgID(), "numberAtlas"), 0);
-			glUniform1i(glGetUniformLocation(this->shader.getProgID(), "useTexture"), 1);
+		/*
+	
+			Desc: Processes Mouse Click Events By Converting Screen Coordinates
+			To Normalized Device Coordinates, Then Through The Camera's Inverse
+			Transform To World Space, And Forwarding To Game Board. Scripted
+			Clicks Take The Same Path, Only Not Through GLFW.
 
-			this->gameBoard.render();
+			Preconditions:
+				1.) Window Must Be Properly Initialized
+				2.) Game Board Must Be Active And Ready
+				3.) xpos And ypos Must Be The Cursor In Window Pixels
+
+			Postconditions:
+				1.) Screen Coordinates Will Be Converted To Normalized Device Coordinates
+				2.) Scene::click Will Forward Them Through The Camera To The Board
+				3.) A Redraw Will Be Requested If The Board Changed
+				4.) The Click Will Be Timed By The Frame Profiler
+
+		*/
+		void handleMouseClick(double xpos, double ypos, bool isRightClick = false)
+		{
+
+			FrameProfiler::CpuScope timer(FrameProfiler::CPU_CLICK);
+
+			// The Scene Maps The Cursor Through The Camera And Updates The Cell Under It
+			if (this->scene.click(this->cursorToNdc(xpos, ypos), isRightClick))
+			{
+				this->needsRedraw = true;
+			}
 
 		}
 
@@ -340,9 +418,7 @@ class Window
 				return;
 			}
 
-			glDeleteVertexArrays(1, &this->VAO);
-			glDeleteBuffers(1, &this->VBO);
-			glDeleteBuffers(1, &this->EBO);
+			this->scene.terminate();
 
 			glfwDestroyWindow(this->window);
 			glfwTerminate();
@@ -364,13 +440,153 @@ class Window
 
 			Postconditions:
 				1.) OpenGL Viewport Will Be Updated To New Dimensions
-				2.) Rendering Will Adapt To New Window Size
+				2.) Rendering Will Adapt To New Window Size, Including The Board's
+				    State Texture Margin
+				3.) win_width And win_height Will Track The New Size So Clicks Map
+				    To The Right Cells
+				4.) A Minimised Window's Zero Size Is Ignored, Keeping The Previous
+				    Size And Viewport
+				5.) A Redraw Will Be Requested
 
 		*/
 		static void frameBufferSizeCallback(GLFWwindow* window, int width, int height)
 		{
 
-			glViewport(0, 0, width, height);
+			Window* windowInstance = static_cast<Window*>(glfwGetWindowUserPointer(window));
+
+			if (windowInstance)
+			{
+				if (width > 0 && height > 0)
+				{
+					windowInstance->win_width = static_cast<unsigned int>(width);
+					windowInstance->win_height = static_cast<unsigned int>(height);
+					windowInstance->scene.setViewport(width, height);
+				}
+			}
+
+			windowRefreshCallback(window);
+
+		}
+
+
+		/*
+
+			Desc: Static Callback For Window Damage (Uncovered, Restored, Resized)
+			Whose Contents The System Asks Us To Redraw.
+
+			Preconditions:
+				1.) Window Must Have Valid User Pointer Set
+
+			Postconditions:
+				1.) A Redraw Will Be Requested
+
+		*/
+		static void windowRefreshCallback(GLFWwindow* window)
+		{
+
+			Window* windowInstance = static_cast<Window*>(glfwGetWindowUserPointer(window));
+
+			if (windowInstance)
+			{
+				windowInstance->needsRedraw = true;
+			}
+
+		}
+
+
+		/*
+
+			Desc: Delivers Every Scripted Event That Is Due, Bypassing GLFW:
+			Clicks Go Straight To handleMouseClick At The Scripted Cursor, And
+			A Quit Event Closes The Window.
+
+			Preconditions:
+				1.) Window Must Be Properly Initialized
+
+			Postconditions:
+				1.) Every Event Due Since The Main Loop Started Will Have Been Handled
+
+		*/
+		void injectScriptedInput()
+		{
+
+			InputScript::Event event;
+
+			while (this->hasScript && this->script.poll(glfwGetTime() - this->scriptStart, event))
+			{
+				if (event.quit)
+				{
+					glfwSetWindowShouldClose(this->window, GLFW_TRUE);
+				}
+				else
+				{
+					this->handleMouseClick(event.x, event.y, event.rightClick);
+				}
+			}
+
+		}
+
+
+		/*
+
+			Desc: Blocks Until The Next Iteration Of The Main Loop Should Run.
+			In Event-Driven Mode The Thread Sleeps In glfwWaitEvents Until Input
+			Or Damage Arrives; A Pending Redraw Held Back By MAX_FPS Sleeps Only
+			Until Its Frame Slot Opens, And Sleeps Never Outlast The Next
+			Scripted Input. Otherwise Events Are Just Polled, And Only Polling
+			Is Timed By The Frame Profiler, As Waits Mostly Sleep.
+
+			Preconditions:
+				1.) Window Must Be Properly Initialized
+
+			Postconditions:
+				1.) Pending Events, Scripted Ones Included, Will Have Been Processed
+				2.) Returns true If A Frame Should Be Drawn Now
+
+		*/
+		bool waitForFrame()
+		{
+
+			const double frameInterval = CONFIG::WINDOW::MAX_FPS > 0.0 ? 1.0 / CONFIG::WINDOW::MAX_FPS : 0.0;
+			double untilSlot = this->lastFrameTime + frameInterval - glfwGetTime();
+
+			if (!CONFIG::WINDOW::EVENT_DRIVEN)
+			{
+				this->needsRedraw = true;
+			}
+
+			// Without A Redraw Pending Only Scripted Input Bounds The Sleep (Negative When There Is None)
+			double untilInput = this->hasScript ? this->script.untilNext(glfwGetTime() - this->scriptStart) : -1.0;
+			double timeout = this->needsRedraw ? untilSlot : untilInput;
+
+			if (this->needsRedraw && untilInput >= 0.0)
+			{
+				timeout = std::min(timeout, untilInput);
+			}
+
+			if (!this->needsRedraw && untilInput < 0.0)
+			{
+				glfwWaitEvents();
+			}
+			else if (timeout > 0.0)
+			{
+				glfwWaitEventsTimeout(timeout);
+			}
+			else
+			{
+				FrameProfiler::CpuScope timer(FrameProfiler::CPU_EVENTS);
+				glfwPollEvents();
+			}
+
+			this->injectScriptedInput();
+
+			if (!this->needsRedraw || this->lastFrameTime + frameInterval > glfwGetTime())
+			{
+				++this->framesSkipped;
+				return false;
+			}
+
+			return true;
 
 		}
 
@@ -419,10 +635,17 @@ class Window
 
 			Postconditions:
 				1.) Game Loop Will Run Until Window Close Is Requested
-				2.) All Events Will Be Processed Each Frame
-				3.) Screen Will Be Cleared And Rendered Each Frame
+				2.) All Events Will Be Processed As They Arrive
+				3.) Screen Will Be Cleared And Rendered Whenever A Redraw Is Due
+				    (Every Iteration Unless CONFIG::WINDOW::EVENT_DRIVEN), At Most
+				    MAX_FPS Times A Second
 				4.) Buffers Will Be Swapped For Smooth Display
-				5.) Window Will Be Terminated When Loop Exits
+				5.) Each Drawn Frame Will End The Frame Profiler's Frame, Collecting
+				    Timer Queries Issued A Frame Earlier, After Resolving The
+				    Latency Of Any Clicks It Shows
+				6.) Frames Drawn And Skipped, GL Calls Per Frame And Timing
+				    Percentiles Will Be Reported And The Window Terminated When The
+				    Loop Exits; The Percentiles Are Only Exported On F4
 
 		*/
 		void mainLoop()
@@ -434,20 +657,44 @@ class Window
 				return;
 			}
 
-			this->shader.use();
-
-			glBindVertexArray(this->VAO);
+			GLState::get().beginFrame();
+			this->scriptStart = glfwGetTime();
 
 			while (!glfwWindowShouldClose(this->window))
 			{
-				glfwPollEvents();
+				if (!this->waitForFrame())
+				{
+					continue;
+				}
 
-				this->clear();
-				this->render();
+				this->scene.clear();
+				this->scene.render();
 
 				glfwSwapBuffers(this->window);
+				LatencyTracker::get().presented();
+				FrameProfiler::get().endFrame();
+
+				this->needsRedraw = false;
+				this->lastFrameTime = glfwGetTime();
+				++this->framesDrawn;
+
+				// Calls Since The Previous Frame, Including Uploads Made By Clicks In Between
+				this->lastFrameCalls = GLState::get().getIssued();
+				this->totalFrameCalls += this->lastFrameCalls;
+				this->totalSkippedBinds += GLState::get().getSkipped();
+				GLState::get().beginFrame();
 			}
 
+			std::cout << "Frames Drawn: " << this->framesDrawn << ", Skipped: " << this->framesSkipped << "\n";
+
+			if (this->framesDrawn > 0)
+			{
+				std::cout << "GL Calls Per Frame: " << static_cast<double>(this->totalFrameCalls) / this->framesDrawn
+						  << " (" << static_cast<double>(this->totalSkippedBinds) / this->framesDrawn << " Redundant Binds Skipped)\n";
+			}
+
+			FrameProfiler::get().print(std::cout);
+
 			this->terminate();
 
 		}
@@ -476,4 +723,23 @@ class Window
 
 		}
 
+
+		/*
+
+			Desc: Frame Pacing Counters. getFramesSkipped Counts Main Loop
+			Wake-Ups That Drew Nothing Because Nothing Changed Or The Frame Cap
+			Held The Redraw Back; getLastFrameCalls Is The Number Of GL Calls
+			The Last Drawn Frame Issued Through GLState.
+
+			Preconditions:
+				1.) None
+
+			Postconditions:
+				1.) Returns The Requested Counter
+
+		*/
+		unsigned long long getFramesDrawn() const { return this->framesDrawn; }
+		unsigned long long getFramesSkipped() const { return this->framesSkipped; }
+		unsigned long long getLastFrameCalls() const { return this->lastFrameCalls; }
+
 };
\ No newline at end of file
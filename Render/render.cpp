@@ -0,0 +1,398 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include "frameprofiler.h"
+#include "inputscript.h"
+#include "latencytracker.h"
+#include "offscreen.h"
+#include "scene.h"
+
+
+struct Move
+{
+    bool flag;
+    unsigned int row, col;
+};
+
+
+/*
+        Desc: Parses One Move Token, r:ROW:COL To Reveal Or f:ROW:COL To
+        Toggle A Flag.
+
+        Preconditions:
+            1.) None
+
+        Postconditions:
+            1.) Returns true And Fills move If token Is A Valid Move
+
+*/
+bool parseMove(const std::string& token, Move& move)
+{
+    char kind = 0;
+    int consumed = 0;
+
+    if (std::sscanf(token.c_str(), "%c:%u:%u%n", &kind, &move.row, &move.col, &consumed) != 3 ||
+        consumed != static_cast<int>(token.size()) || (kind != 'r' && kind != 'f'))
+    {
+        return false;
+    }
+
+    move.flag = kind == 'f';
+    return true;
+}
+
+
+/*
+        Desc: Collects Moves From The Command Line, Expanding @FILE Arguments
+        Into The Whitespace Separated Moves Inside The File.
+
+        Preconditions:
+            1.) None
+
+        Postconditions:
+            1.) moves Will Hold Every Move In Order
+            2.) Returns false, Having Reported The Offending Token, On A Bad Move
+
+*/
+bool collectMove(const std::string& argument, std::vector<Move>& moves)
+{
+    std::vector<std::string> tokens;
+
+    if (!argument.empty() && argument[0] == '@')
+    {
+        std::ifstream file(argument.substr(1));
+
+        if (!file.is_open())
+        {
+            std::cerr << "Failed To Open Move List: " << argument.substr(1) << "\n";
+            return false;
+        }
+
+        for (std::string token; file >> token;)
+        {
+            tokens.push_back(token);
+        }
+    }
+    else
+    {
+        tokens.push_back(argument);
+    }
+
+    for (const std::string& token : tokens)
+    {
+        Move move;
+
+        if (!parseMove(token, move))
+        {
+            std::cerr << "Invalid Move: " << token << " (Expected r:ROW:COL Or f:ROW:COL)\n";
+            return false;
+        }
+
+        moves.push_back(move);
+    }
+
+    return true;
+}
+
+
+/*
+        Desc: Draws One Frame Of The Scene Into The Offscreen Framebuffer And
+        Ends The Frame Profiler's Frame.
+
+        Preconditions:
+            1.) The Offscreen Context Must Be Current And scene Initialized
+
+        Postconditions:
+            1.) The Framebuffer Will Hold The Current Board
+
+*/
+void drawFrame(Scene& scene)
+{
+    scene.clear();
+    scene.render();
+    FrameProfiler::get().endFrame();
+}
+
+
+/*
+        Desc: Times frames Redraws Of The Final Board, Waiting On glFinish After
+        Each So The Figure Is The Full Cost Of Board::render On This Driver
+        (llvmpipe On A Server, Which Makes It Repeatable Across Machines).
+
+        Preconditions:
+            1.) The Offscreen Context Must Be Current And scene Initialized
+
+        Postconditions:
+            1.) Mean, Median And Best Frame Times Will Be Printed, Followed By
+                The Frame Profiler's GPU Percentiles
+
+*/
+void benchmarkRender(Scene& scene, unsigned int frames)
+{
+    std::vector<double> times;
+    times.reserve(frames);
+
+    // One Untimed Frame So Shader Compilation And First Uploads Are Excluded
+    drawFrame(scene);
+    glFinish();
+
+    for (unsigned int i = 0; i < frames; ++i)
+    {
+        auto start = std::chrono::steady_clock::now();
+        drawFrame(scene);
+        glFinish();
+        times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    if (times.empty())
+    {
+        return;
+    }
+
+    double total = 0.0;
+
+    for (double time : times)
+    {
+        total += time;
+    }
+
+    std::sort(times.begin(), times.end());
+
+    std::cout << "Rendered " << frames << " Frames: " << total / frames << " ms Mean, "
+              << times[times.size() / 2] << " ms Median, " << times.front() << " ms Best ("
+              << 1000.0 * frames / total << " Frames/s) On " << glGetString(GL_RENDERER) << "\n";
+
+    FrameProfiler::get().print(std::cout);
+}
+
+
+/*
+        Desc: Replays An Input Script's Clicks Through Scene::click, The Path
+        The Game's Clicks Take Minus GLFW, Ignoring Event Times So Runs Are
+        Reproducible. Each Click That Changes The Board Is Drawn And Then
+        Fenced By LatencyTracker, Timing It From Injection Through The Board
+        Update And Upload To The Finished Frame.
+
+        Preconditions:
+            1.) The Offscreen Context Must Be Current And scene Initialized
+            2.) width And height Must Be The Image Size Script Positions Refer To
+
+        Postconditions:
+            1.) Every Click Up To The First Quit Event Will Have Been Applied
+            2.) With everyMove, PREFIX_NNNN.png Will Be Written Per Changing Click,
+                Numbered On From frame
+            3.) Returns The Number Of Clicks That Changed The Board
+
+*/
+size_t replayScript(Scene& scene, Offscreen& target, InputScript& script, unsigned int width, unsigned int height,
+                    bool everyMove, const std::string& prefix, size_t frame)
+{
+    InputScript::Event event;
+    size_t changed = 0;
+    char name[32];
+
+    while (script.poll(std::numeric_limits<double>::infinity(), event) && !event.quit)
+    {
+        // Window Pixels To Normalized Device Coordinates, As Window::cursorToNdc Maps Them
+        glm::vec2 ndc((2.0f * event.x) / width - 1.0f, 1.0f - (2.0f * event.y) / height);
+
+        if (!scene.click(ndc, event.rightClick))
+        {
+            continue;
+        }
+
+        drawFrame(scene);
+        LatencyTracker::get().presented();
+
+        if (everyMove)
+        {
+            std::snprintf(name, sizeof(name), "_%04zu.png", frame + changed);
+            target.capture(prefix + name);
+        }
+
+        ++changed;
+    }
+
+    return changed;
+}
+
+
+/*
+        Desc: Entry Point For The Offscreen Renderer, Which Draws Boards With
+        The Same Scene As The Game But Into An EGL Framebuffer, So Thumbnails,
+        Replay Frames And Reference Images Can Be Made On A Server With No
+        Display Or GPU (Mesa's llvmpipe). Like The Game It Loads The Shaders
+        From The Working Directory, So Run It From Minesweeper/.
+
+        Usage:
+            Render [options] [moves...]
+
+            --seed N            Board Seed (Default 1)
+            --size WxH          Image Size In Pixels (Default The Window Size)
+            --board RxCxM       Rows, Columns And Mines (Default CONFIG::BOARD)
+            --out PREFIX        Output Path Prefix (Default "board")
+            --every             Also Write PREFIX_NNNN.png After Every Move
+            --bench N           Time N Redraws Of The Final Board
+            --overlay           Draw The Frame Timing Overlay Over Every Image
+            --script FILE       After The Moves, Replay FILE's Clicks (The Game's
+                                Input Script Format, Positions In Image Pixels)
+                                And Report Their Latency
+
+            Moves Are r:ROW:COL (Reveal) Or f:ROW:COL (Toggle Flag); @FILE
+            Reads Whitespace Separated Moves From FILE.
+
+        Build (Linux, Mesa):
+            g++ -std=c++14 -O2 -I../Minesweeper -I../Libraries/include render.cpp ../Minesweeper/glad.c -lEGL -o Render
+
+        Preconditions:
+            1.) An EGL Implementation Must Be Installed
+
+        Postconditions:
+            1.) PREFIX.png Will Hold The Board After The Last Move
+            2.) Application Will Return 0 On Success, 1 On Bad Arguments Or Setup Failure
+
+*/
+int main(int argc, char** argv)
+{
+    uint64_t seed = 1;
+    unsigned int width = CONFIG::WINDOW::WIDTH, height = CONFIG::WINDOW::HEIGHT;
+    unsigned int rows = CONFIG::BOARD::ROW_COUNT, cols = CONFIG::BOARD::COL_COUNT, mines = CONFIG::BOARD::MINE_COUNT;
+    std::string prefix = "board";
+    bool everyMove = false;
+    unsigned int benchFrames = 0;
+    bool overlay = false;
+    std::string scriptPath;
+    std::vector<Move> moves;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string argument = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (argument == "--seed" && hasValue)
+        {
+            seed = static_cast<uint64_t>(std::stoull(argv[++i]));
+        }
+        else if (argument == "--size" && hasValue && std::sscanf(argv[i + 1], "%ux%u", &width, &height) == 2)
+        {
+            ++i;
+        }
+        else if (argument == "--board" && hasValue && std::sscanf(argv[i + 1], "%ux%ux%u", &rows, &cols, &mines) == 3)
+        {
+            ++i;
+        }
+        else if (argument == "--out" && hasValue)
+        {
+            prefix = argv[++i];
+        }
+        else if (argument == "--every")
+        {
+            everyMove = true;
+        }
+        else if (argument == "--bench" && hasValue)
+        {
+            benchFrames = static_cast<unsigned int>(std::stoul(argv[++i]));
+        }
+        else if (argument == "--overlay")
+        {
+            overlay = true;
+        }
+        else if (argument == "--script" && hasValue)
+        {
+            scriptPath = argv[++i];
+        }
+        else if (argument.compare(0, 2, "--") == 0 || !collectMove(argument, moves))
+        {
+            std::cerr << "Usage: Render [--seed N] [--size WxH] [--board RxCxM] [--out PREFIX] [--every] [--bench N] [--overlay] [--script FILE] [r:ROW:COL | f:ROW:COL | @FILE]...\n";
+            return 1;
+        }
+    }
+
+    if (width == 0 || height == 0 || rows == 0 || cols == 0 || mines > static_cast<uint64_t>(rows) * cols)
+    {
+        std::cerr << "Image And Board Sizes Must Be Positive, With At Most One Mine Per Cell...\n";
+        return 1;
+    }
+
+    InputScript script;
+
+    if (!scriptPath.empty() && !script.load(scriptPath))
+    {
+        return 1;
+    }
+
+    LatencyTracker::get().setScripted(!scriptPath.empty());
+
+    Offscreen target(width, height);
+    Scene scene(rows, cols, mines);
+
+    if (!target.initialize() || !scene.initialize(seed, width, height))
+    {
+        std::cerr << "Offscreen Rendering Initialization Has Failed...\n";
+        return 1;
+    }
+
+    Board& board = scene.getBoard();
+    char name[32];
+
+    scene.setOverlay(overlay);
+
+    for (size_t i = 0; i < moves.size(); ++i)
+    {
+        const Move& move = moves[i];
+
+        if (move.row >= rows || move.col >= cols)
+        {
+            std::cerr << "Skipping Move Outside The Board: (" << move.row << ", " << move.col << ")\n";
+            continue;
+        }
+
+        if (move.flag)
+        {
+            board.toggleFlag(move.row, move.col);
+        }
+        else
+        {
+            board.updateCell(move.row, move.col);
+        }
+
+        board.updateVertexBuffer();
+
+        if (everyMove)
+        {
+            std::snprintf(name, sizeof(name), "_%04zu.png", i);
+            drawFrame(scene);
+            target.capture(prefix + name);
+        }
+    }
+
+    if (!scriptPath.empty())
+    {
+        size_t changed = replayScript(scene, target, script, width, height, everyMove, prefix, moves.size());
+
+        std::cout << "Replayed " << script.getEventCount() << " Scripted Event(s), " << changed << " Changed The Board\n";
+        FrameProfiler::get().print(std::cout);
+    }
+
+    drawFrame(scene);
+    target.capture(prefix + ".png");
+
+    if (benchFrames > 0)
+    {
+        benchmarkRender(scene, benchFrames);
+    }
+
+    target.flush();
+    std::cout << "Wrote " << target.getFramesWritten() << " Frame(s) To " << prefix << "*.png\n";
+
+    scene.terminate();
+
+    return 0;
+}
\ No newline at end of file